@@ -0,0 +1,485 @@
+/******************************************************************************
+ * QSkinny - Copyright (C) The authors
+ *           SPDX-License-Identifier: BSD-3-Clause
+ *****************************************************************************/
+
+#include "Benchmark.h"
+
+#include <QskFrameProfiler.h>
+#include <QskObjectCounter.h>
+
+#include <QCommandLineParser>
+#include <QElapsedTimer>
+#include <QEventLoop>
+#include <QFile>
+#include <QJsonArray>
+#include <QJsonDocument>
+#include <QJsonObject>
+#include <QQuickWindow>
+#include <QTimer>
+#include <QVector>
+
+#include <qsggeometry.h>
+#include <qsgnode.h>
+
+QSK_QT_PRIVATE_BEGIN
+#include <private/qquickwindow_p.h>
+#include <private/qsgrenderer_p.h>
+QSK_QT_PRIVATE_END
+
+#include <algorithm>
+#include <atomic>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <new>
+
+/*
+    Counting the heap allocations of the benchmark process. With glibc
+    malloc itself is replaced, so that the allocations of the Qt containers
+    and of the system libraries are included. Otherwise we can only count
+    the C++ allocations ( operator new ).
+ */
+
+static std::atomic< quint64 > qskAllocations { 0 };
+static std::atomic< quint64 > qskAllocatedBytes { 0 };
+
+static inline void qskCountAllocation( std::size_t size )
+{
+    qskAllocations.fetch_add( 1, std::memory_order_relaxed );
+    qskAllocatedBytes.fetch_add( size, std::memory_order_relaxed );
+}
+
+#if defined( __GLIBC__ )
+
+extern "C"
+{
+    void* __libc_malloc( std::size_t );
+    void* __libc_calloc( std::size_t, std::size_t );
+    void* __libc_realloc( void*, std::size_t );
+
+    void* malloc( std::size_t size ) noexcept
+    {
+        qskCountAllocation( size );
+        return __libc_malloc( size );
+    }
+
+    void* calloc( std::size_t count, std::size_t size ) noexcept
+    {
+        qskCountAllocation( count * size );
+        return __libc_calloc( count, size );
+    }
+
+    void* realloc( void* ptr, std::size_t size ) noexcept
+    {
+        qskCountAllocation( size );
+        return __libc_realloc( ptr, size );
+    }
+}
+
+#else
+
+void* operator new( std::size_t size )
+{
+    qskCountAllocation( size );
+
+    if ( auto ptr = std::malloc( size ? size : 1 ) )
+        return ptr;
+
+    throw std::bad_alloc();
+}
+
+void* operator new( std::size_t size, const std::nothrow_t& ) noexcept
+{
+    qskCountAllocation( size );
+    return std::malloc( size ? size : 1 );
+}
+
+void operator delete( void* ptr ) noexcept
+{
+    std::free( ptr );
+}
+
+void operator delete( void* ptr, std::size_t ) noexcept
+{
+    std::free( ptr );
+}
+
+#endif
+
+namespace
+{
+    class NodeStatistics
+    {
+      public:
+        void add( const QSGNode* node )
+        {
+            nodes++;
+
+            if ( node->type() == QSGNode::GeometryNodeType )
+            {
+                geometryNodes++;
+
+                auto geometry = static_cast< const QSGGeometryNode* >( node )->geometry();
+                if ( geometry )
+                    vertexBytes += geometry->vertexCount() * geometry->sizeOfVertex();
+            }
+
+            for ( auto child = node->firstChild(); child; child = child->nextSibling() )
+                add( child );
+        }
+
+        int nodes = 0;
+        int geometryNodes = 0;
+        qint64 vertexBytes = 0;
+    };
+
+    class Scenario
+    {
+      public:
+        QString name;
+        int frameCount;
+        std::function< void( int ) > script;
+    };
+
+    class Result
+    {
+      public:
+        QString name;
+
+        int frames = 0;
+        int failedFrames = 0;
+
+        double fps = 0.0;
+        double meanTime = 0.0; // ms
+        double p95Time = 0.0; // ms
+        double maxTime = 0.0; // ms
+
+        double phaseTime[ QskFrameProfiler::PhaseCount ] = {}; // ms
+
+        double allocationsPerFrame = 0.0;
+        double allocatedBytesPerFrame = 0.0;
+        int createdObjects = 0;
+
+        NodeStatistics nodes;
+    };
+}
+
+static NodeStatistics qskNodeStatistics( QQuickWindow* window )
+{
+    NodeStatistics statistics;
+
+    // with the basic render loop we are in the scene graph thread
+
+    auto d = QQuickWindowPrivate::get( window );
+    if ( d->renderer && d->renderer->rootNode() )
+        statistics.add( d->renderer->rootNode() );
+
+    return statistics;
+}
+
+static bool qskRenderFrame( QQuickWindow* window )
+{
+    QEventLoop loop;
+
+    QTimer timer;
+    timer.setSingleShot( true );
+
+    QObject::connect( window, &QQuickWindow::frameSwapped,
+        &loop, [ &loop ] { loop.exit( 0 ); } );
+
+    QObject::connect( &timer, &QTimer::timeout,
+        &loop, [ &loop ] { loop.exit( 1 ); } );
+
+    window->update();
+    timer.start( 5000 );
+
+    return loop.exec() == 0;
+}
+
+static double qskPercentile( QVector< double > values, double percentile )
+{
+    if ( values.isEmpty() )
+        return 0.0;
+
+    std::sort( values.begin(), values.end() );
+
+    const auto index = static_cast< int >( std::ceil( percentile * values.size() ) ) - 1;
+    return values[ qBound( 0, index, int( values.size() ) - 1 ) ];
+}
+
+static QJsonObject qskToJson( const Result& result )
+{
+    QJsonObject phases;
+    for ( int i = 0; i < QskFrameProfiler::PhaseCount; i++ )
+    {
+        static const char* names[] = { "polish", "sync", "render", "swap" };
+        phases[ names[ i ] ] = result.phaseTime[ i ];
+    }
+
+    QJsonObject object;
+    object[ "name" ] = result.name;
+    object[ "frames" ] = result.frames;
+    object[ "failedFrames" ] = result.failedFrames;
+    object[ "fps" ] = result.fps;
+    object[ "meanFrameTime" ] = result.meanTime;
+    object[ "p95FrameTime" ] = result.p95Time;
+    object[ "maxFrameTime" ] = result.maxTime;
+    object[ "phases" ] = phases;
+    object[ "allocationsPerFrame" ] = result.allocationsPerFrame;
+    object[ "allocatedBytesPerFrame" ] = result.allocatedBytesPerFrame;
+    object[ "createdObjects" ] = result.createdObjects;
+    object[ "nodes" ] = result.nodes.nodes;
+    object[ "geometryNodes" ] = result.nodes.geometryNodes;
+    object[ "vertexBytes" ] = result.nodes.vertexBytes;
+
+    return object;
+}
+
+class Benchmark::PrivateData
+{
+  public:
+    Result run( const Scenario& scenario, int frameCount, int warmupCount )
+    {
+        for ( int i = 0; i < warmupCount; i++ )
+        {
+            scenario.script( i );
+            qskRenderFrame( window );
+        }
+
+        profiler->reset();
+
+        Result result;
+        result.name = scenario.name;
+
+        QVector< double > frameTimes;
+        frameTimes.reserve( frameCount );
+
+        QskObjectCounter counter;
+        const auto allocations = qskAllocations.load();
+        const auto allocatedBytes = qskAllocatedBytes.load();
+
+        QElapsedTimer totalTimer;
+        totalTimer.start();
+
+        for ( int i = 0; i < frameCount; i++ )
+        {
+            QElapsedTimer timer;
+            timer.start();
+
+            scenario.script( warmupCount + i );
+
+            if ( qskRenderFrame( window ) )
+                frameTimes += timer.nsecsElapsed() / 1e6;
+            else
+                result.failedFrames++;
+        }
+
+        const auto totalTime = totalTimer.nsecsElapsed() / 1e6;
+
+        result.frames = frameTimes.size();
+
+        if ( result.frames > 0 )
+        {
+            double sum = 0.0;
+            for ( const auto time : std::as_const( frameTimes ) )
+            {
+                sum += time;
+                result.maxTime = qMax( result.maxTime, time );
+            }
+
+            result.meanTime = sum / result.frames;
+            result.p95Time = qskPercentile( frameTimes, 0.95 );
+            result.fps = 1000.0 * result.frames / totalTime;
+
+            result.allocationsPerFrame =
+                double( qskAllocations.load() - allocations ) / result.frames;
+
+            result.allocatedBytesPerFrame =
+                double( qskAllocatedBytes.load() - allocatedBytes ) / result.frames;
+        }
+
+        const auto frames = profiler->frames();
+        if ( !frames.isEmpty() )
+        {
+            for ( const auto& frame : frames )
+            {
+                for ( int i = 0; i < QskFrameProfiler::PhaseCount; i++ )
+                    result.phaseTime[ i ] += frame.phaseTime[ i ] / 1e6;
+            }
+
+            for ( auto& time : result.phaseTime )
+                time /= frames.size();
+        }
+
+        result.createdObjects = counter.created( QskObjectCounter::Objects );
+        result.nodes = qskNodeStatistics( window );
+
+        return result;
+    }
+
+    void report( const Result& result ) const
+    {
+        std::printf( "%-24s %6d frames %8.1f fps  mean %7.2f ms  p95 %7.2f ms  max %7.2f ms\n",
+            qPrintable( result.name ), result.frames, result.fps,
+            result.meanTime, result.p95Time, result.maxTime );
+
+        std::printf( "%-24s polish %6.2f ms  sync %6.2f ms  render %6.2f ms  swap %6.2f ms\n", "",
+            result.phaseTime[ QskFrameProfiler::Polish ], result.phaseTime[ QskFrameProfiler::Sync ],
+            result.phaseTime[ QskFrameProfiler::Render ], result.phaseTime[ QskFrameProfiler::Swap ] );
+
+        std::printf( "%-24s %.1f allocations/frame  %.0f bytes/frame  %d objects created  "
+            "%d nodes  %d geometry nodes  %lld vertex bytes\n", "",
+            result.allocationsPerFrame, result.allocatedBytesPerFrame, result.createdObjects,
+            result.nodes.nodes, result.nodes.geometryNodes,
+            static_cast< long long >( result.nodes.vertexBytes ) );
+
+        auto records = profiler->records();
+        std::sort( records.begin(), records.end(),
+            []( const QskFrameProfiler::Record& r1, const QskFrameProfiler::Record& r2 )
+            { return r1.time > r2.time; } );
+
+        for ( int i = 0; i < qMin( 3, int( records.size() ) ); i++ )
+        {
+            const auto& r = records[ i ];
+
+            std::printf( "%-24s   %s%s: %d calls, %.2f ms\n", "",
+                r.className, r.nodeRole >= 0 ? qPrintable(
+                    QStringLiteral( "/role %1" ).arg( r.nodeRole ) ) : "",
+                r.count, r.time / 1e6 );
+        }
+
+        if ( result.failedFrames > 0 )
+            std::printf( "%-24s %d frames not rendered\n", "", result.failedFrames );
+
+        std::fflush( stdout );
+    }
+
+    QString name;
+    QQuickWindow* window;
+    QskFrameProfiler* profiler;
+
+    QVector< Scenario > scenarios;
+};
+
+void Benchmark::initEnvironment()
+{
+    if ( !qEnvironmentVariableIsSet( "QT_QPA_PLATFORM" ) )
+        qputenv( "QT_QPA_PLATFORM", "offscreen" );
+
+    // all phases of a frame in the GUI thread
+    if ( !qEnvironmentVariableIsSet( "QSG_RENDER_LOOP" ) )
+        qputenv( "QSG_RENDER_LOOP", "basic" );
+
+    // not waiting for vsync
+    if ( !qEnvironmentVariableIsSet( "QSG_NO_VSYNC" ) )
+        qputenv( "QSG_NO_VSYNC", "1" );
+}
+
+Benchmark::Benchmark( const QString& name, QQuickWindow* window )
+    : m_data( new PrivateData() )
+{
+    m_data->name = name;
+    m_data->window = window;
+    m_data->profiler = new QskFrameProfiler( window );
+}
+
+Benchmark::~Benchmark()
+{
+}
+
+void Benchmark::addScenario( const QString& name, int frameCount,
+    const std::function< void( int ) >& script )
+{
+    Scenario scenario;
+    scenario.name = name;
+    scenario.frameCount = frameCount;
+    scenario.script = script;
+
+    m_data->scenarios += scenario;
+}
+
+int Benchmark::exec( const QStringList& arguments )
+{
+    QCommandLineParser parser;
+    parser.addHelpOption();
+
+    const QCommandLineOption framesOption( "frames",
+        "Number of frames for each scenario.", "n" );
+    const QCommandLineOption warmupOption( "warmup",
+        "Number of unmeasured frames.", "n", "10" );
+    const QCommandLineOption scenarioOption( "scenario",
+        "Run this scenario only.", "name" );
+    const QCommandLineOption maxP95Option( "max-p95",
+        "Fail, when the p95 frame time exceeds this value.", "ms" );
+    const QCommandLineOption jsonOption( "json",
+        "Write the results as JSON.", "file" );
+    const QCommandLineOption traceOption( "trace",
+        "Write a Chrome trace of the last scenario.", "file" );
+
+    parser.addOptions( { framesOption, warmupOption, scenarioOption,
+        maxP95Option, jsonOption, traceOption } );
+
+    parser.process( arguments );
+
+    const int warmupCount = qMax( parser.value( warmupOption ).toInt(), 0 );
+    const double maxP95 = parser.isSet( maxP95Option )
+        ? parser.value( maxP95Option ).toDouble() : -1.0;
+
+    auto window = m_data->window;
+
+    window->show();
+    if ( !qskRenderFrame( window ) )
+    {
+        std::fprintf( stderr, "%s: the window does not render.\n", qPrintable( m_data->name ) );
+        return 2;
+    }
+
+    std::printf( "* %s\n", qPrintable( m_data->name ) );
+
+    QJsonArray results;
+    bool failed = false;
+
+    for ( const auto& scenario : std::as_const( m_data->scenarios ) )
+    {
+        if ( parser.isSet( scenarioOption )
+            && parser.value( scenarioOption ) != scenario.name )
+        {
+            continue;
+        }
+
+        int frameCount = scenario.frameCount;
+        if ( parser.isSet( framesOption ) )
+            frameCount = parser.value( framesOption ).toInt();
+
+        const auto result = m_data->run( scenario, frameCount, warmupCount );
+        m_data->report( result );
+
+        results += qskToJson( result );
+
+        if ( result.failedFrames > 0 )
+            failed = true;
+
+        if ( maxP95 > 0.0 && result.p95Time > maxP95 )
+        {
+            std::printf( "%-24s p95 frame time exceeds %.2f ms\n", "", maxP95 );
+            failed = true;
+        }
+    }
+
+    if ( parser.isSet( jsonOption ) )
+    {
+        QJsonObject object;
+        object[ "benchmark" ] = m_data->name;
+        object[ "scenarios" ] = results;
+
+        QFile file( parser.value( jsonOption ) );
+        if ( file.open( QIODevice::WriteOnly | QIODevice::Truncate ) )
+            file.write( QJsonDocument( object ).toJson() );
+    }
+
+    if ( parser.isSet( traceOption ) )
+        m_data->profiler->writeChromeTrace( parser.value( traceOption ) );
+
+    return failed ? 1 : 0;
+}
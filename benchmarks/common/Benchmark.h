@@ -0,0 +1,57 @@
+/******************************************************************************
+ * QSkinny - Copyright (C) The authors
+ *           SPDX-License-Identifier: BSD-3-Clause
+ *****************************************************************************/
+
+#pragma once
+
+#include <QString>
+
+#include <functional>
+#include <memory>
+
+class QQuickWindow;
+class QStringList;
+
+/*
+    A simple harness for driving a window frame by frame through
+    the Qt/Quick render loop, while a script modifies the scene.
+
+    The window is rendered on the "offscreen" platform with the
+    basic render loop, so that all phases of a frame are processed
+    in the GUI thread and the timing is reproducible. Using Mesa/llvmpipe
+    ( LIBGL_ALWAYS_SOFTWARE=1 ) makes the results independent from the GPU.
+
+    For each scenario the harness reports frames per second, mean/p95/maximum
+    frame times, heap allocations and allocated bytes per frame and the number of
+    scene graph nodes.
+ */
+class Benchmark
+{
+  public:
+    // has to be called before creating the application object
+    static void initEnvironment();
+
+    Benchmark( const QString& name, QQuickWindow* );
+    ~Benchmark();
+
+    // script is called before each frame with the frame number
+    void addScenario( const QString& name, int frameCount,
+        const std::function< void( int frame ) >& script );
+
+    /*
+        Runs all scenarios and returns the exit code for main:
+
+        --frames <n>     overriding the number of frames of each scenario
+        --warmup <n>     number of unmeasured frames ( default: 10 )
+        --scenario <s>   run the scenario <s> only
+        --max-p95 <ms>   fail, when the p95 frame time exceeds <ms>
+        --json <file>    write the results to <file>
+        --trace <file>   write a Chrome trace of the last scenario to <file>
+     */
+    int exec( const QStringList& arguments );
+
+  private:
+    class PrivateData;
+    std::unique_ptr< PrivateData > m_data;
+};
@@ -0,0 +1,115 @@
+/******************************************************************************
+ * QSkinny - Copyright (C) The authors
+ *           SPDX-License-Identifier: BSD-3-Clause
+ *****************************************************************************/
+
+#include <Benchmark.h>
+
+#include <QskColorFilter.h>
+#include <QskGraphic.h>
+#include <QskGraphicDiskCache.h>
+
+#include <QElapsedTimer>
+#include <QGuiApplication>
+#include <QPainter>
+#include <QPainterPath>
+#include <QTemporaryDir>
+#include <QVector>
+#include <QtMath>
+
+#include <cstdio>
+
+/*
+    Rasterizing a set of graphics twice: the first time with an empty
+    disk cache, the second time with new instances of the same graphics.
+    As the new instances have different modification ids, this is like
+    starting the application again: all images have to be found in the cache.
+ */
+
+static const int graphicCount = 200;
+
+static QskGraphic qskCreateGraphic( int index )
+{
+    const int pointCount = 5 + index % 7;
+
+    QPainterPath path;
+
+    for ( int i = 0; i < 2 * pointCount; i++ )
+    {
+        const qreal radius = ( i % 2 ) ? 20.0 : 50.0;
+        const qreal angle = i * M_PI / pointCount + index;
+
+        const QPointF pos( 50.0 + radius * qCos( angle ), 50.0 + radius * qSin( angle ) );
+
+        if ( i == 0 )
+            path.moveTo( pos );
+        else
+            path.lineTo( pos );
+    }
+
+    path.closeSubpath();
+
+    QskGraphic graphic;
+
+    QPainter painter( &graphic );
+    painter.setRenderHint( QPainter::Antialiasing );
+    painter.setPen( QPen( Qt::darkBlue, 2 ) );
+    painter.setBrush( QColor::fromHsl( ( index * 37 ) % 360, 200, 128 ) );
+    painter.drawPath( path );
+    painter.end();
+
+    return graphic;
+}
+
+static double qskLoadImages( const QSize& size )
+{
+    QVector< QskGraphic > graphics;
+    graphics.reserve( graphicCount );
+
+    for ( int i = 0; i < graphicCount; i++ )
+        graphics += qskCreateGraphic( i );
+
+    QElapsedTimer timer;
+    timer.start();
+
+    for ( const auto& graphic : std::as_const( graphics ) )
+        ( void ) QskGraphicDiskCache::image( graphic, QskColorFilter(), size, 1.0 );
+
+    return timer.nsecsElapsed() / 1e6;
+}
+
+int main( int argc, char* argv[] )
+{
+    Benchmark::initEnvironment();
+
+    QGuiApplication app( argc, argv );
+
+    QTemporaryDir directory;
+    if ( !directory.isValid() )
+        return 1;
+
+    QskGraphicDiskCache::setDirectory( directory.path() );
+
+    const QSize size( 96, 96 );
+
+    const auto renderTime = qskLoadImages( size );
+    QskGraphicDiskCache::waitForDone();
+
+    QskGraphicDiskCache::resetStatistics();
+
+    const auto cacheTime = qskLoadImages( size );
+    QskGraphicDiskCache::waitForDone();
+
+    const auto statistics = QskGraphicDiskCache::statistics();
+
+    std::printf( "%d graphics: rendered in %.2f ms, loaded from the cache in %.2f ms\n",
+        graphicCount, renderTime, cacheTime );
+
+    std::printf( "%llu hits, %llu misses\n",
+        static_cast< unsigned long long >( statistics.hitCount ),
+        static_cast< unsigned long long >( statistics.missCount ) );
+
+    QskGraphicDiskCache::setDirectory( QString() );
+
+    return ( statistics.hitCount == quint64( graphicCount ) ) ? 0 : 1;
+}
@@ -0,0 +1,86 @@
+/******************************************************************************
+ * QSkinny - Copyright (C) The authors
+ *           SPDX-License-Identifier: BSD-3-Clause
+ *****************************************************************************/
+
+#include "label/LabelPage.h"
+#include "progressbar/ProgressBarPage.h"
+#include "inputs/InputPage.h"
+#include "button/ButtonPage.h"
+#include "selector/SelectorPage.h"
+#include "listbox/ListBoxPage.h"
+
+#include "GraphicProvider.h"
+#include "TabView.h"
+
+#include <Benchmark.h>
+#include <SkinnyNamespace.h>
+#include <SkinnyShapeProvider.h>
+
+#include <QskScrollArea.h>
+#include <QskSkinManager.h>
+#include <QskWindow.h>
+
+#include <QGuiApplication>
+
+int main( int argc, char* argv[] )
+{
+    Benchmark::initEnvironment();
+
+    Qsk::addGraphicProvider( QString(), new GraphicProvider() );
+    Qsk::addGraphicProvider( "shapes", new SkinnyShapeProvider() );
+
+    QGuiApplication app( argc, argv );
+
+    auto tabView = new TabView();
+    tabView->addPage( "Buttons", new ButtonPage() );
+    tabView->addPage( "Labels", new LabelPage() );
+    tabView->addPage( "Inputs", new InputPage() );
+    tabView->addPage( "Progress\nBars", new ProgressBarPage() );
+    tabView->addPage( "Selectors", new SelectorPage() );
+    tabView->addPage( "ListBox", new ListBoxPage() );
+
+    QskWindow window;
+    window.addItem( tabView );
+
+    // small enough to have something to scroll
+    window.resize( 600, 400 );
+
+    Benchmark benchmark( "gallery", &window );
+
+    benchmark.addScenario( "scrolling", 300,
+        [ tabView ]( int frame )
+        {
+            const int pageCount = tabView->count();
+
+            if ( frame % 60 == 0 )
+                tabView->setCurrentIndex( ( frame / 60 ) % pageCount );
+
+            auto scrollArea = tabView->currentScrollArea();
+
+            const auto size = scrollArea->scrollableSize();
+            const auto ratio = ( frame % 60 ) / 59.0;
+
+            scrollArea->setScrollPos( QPointF( 0.0, ratio * size.height() ) );
+        } );
+
+    benchmark.addScenario( "page transitions", 300,
+        [ tabView ]( int frame )
+        {
+            if ( frame % 10 == 0 )
+                tabView->setCurrentIndex( ( frame / 10 ) % tabView->count() );
+        } );
+
+    benchmark.addScenario( "skin switching", 100,
+        []( int frame )
+        {
+            if ( frame % 10 == 0 )
+            {
+                const auto count = qskSkinManager->skinNames().count();
+                if ( count > 0 )
+                    Skinny::setSkin( ( frame / 10 ) % count, 0 );
+            }
+        } );
+
+    return benchmark.exec( app.arguments() );
+}
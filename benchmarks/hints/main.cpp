@@ -0,0 +1,106 @@
+/******************************************************************************
+ * QSkinny - Copyright (C) The authors
+ *           SPDX-License-Identifier: BSD-3-Clause
+ *****************************************************************************/
+
+#include <Benchmark.h>
+
+#include <QskBox.h>
+#include <QskMemoryStatistics.h>
+#include <QskWindow.h>
+
+#include <QColor>
+#include <QGuiApplication>
+#include <QVector>
+
+#include <cstdio>
+
+/*
+    A synthetic scene with many controls, where most of them have a
+    couple of local hints: the memory of the local hint tables is
+    reported before and after running the scenarios.
+
+    The values of the hints, that do not fit into a QVariant, are not included.
+ */
+
+static const int controlCount = 20000;
+
+static void qskSetLocalHints( QskBox* box, int index )
+{
+    // 1-3 local hints
+    box->setColor( QskBox::Panel, ( index % 2 ) ? Qt::darkBlue : Qt::darkGreen );
+
+    if ( index % 3 > 0 )
+        box->setMetric( QskBox::Panel | QskAspect::Spacing, index % 10 );
+
+    if ( index % 3 > 1 )
+        box->setPaddingHint( QskBox::Panel, 2 );
+
+    // some of them with a proxy
+    if ( index % 10 == 0 )
+        box->setSubcontrolProxy( QskControl::Background, QskBox::Panel );
+}
+
+static void qskPrintHintStatistics( const QskMemoryStatistics& statistics )
+{
+    const auto hints = statistics.totalHintStatistics();
+
+    std::printf( "%d skinnables, %d local hints, %lld bytes ( %.1f bytes/skinnable )\n",
+        hints.skinnableCount, hints.hintCount, static_cast< long long >( hints.bytes ),
+        hints.skinnableCount ? double( hints.bytes ) / hints.skinnableCount : 0.0 );
+}
+
+int main( int argc, char* argv[] )
+{
+    Benchmark::initEnvironment();
+
+    QGuiApplication app( argc, argv );
+
+    auto root = new QskBox();
+
+    QVector< QskBox* > boxes;
+    boxes.reserve( controlCount );
+
+    for ( int i = 0; i < controlCount; i++ )
+    {
+        auto box = new QskBox( true, root );
+        box->setGeometry( ( i % 200 ) * 4, ( i / 200 ) * 6, 4, 6 );
+
+        qskSetLocalHints( box, i );
+        boxes += box;
+    }
+
+    QskWindow window;
+    window.addItem( root );
+    window.resize( 800, 600 );
+
+    qskPrintHintStatistics( QskMemoryStatistics( &window ) );
+
+    Benchmark benchmark( "hints", &window );
+
+    benchmark.addScenario( "local hint updates", 100,
+        [ &boxes ]( int frame )
+        {
+            // modifying the hints of every 10th control
+            for ( int i = frame % 10; i < boxes.count(); i += 10 )
+                boxes[i]->setColor( QskBox::Panel, QColor::fromHsl( frame % 360, 255, 128 ) );
+        } );
+
+    benchmark.addScenario( "local hint resets", 100,
+        [ &boxes ]( int frame )
+        {
+            // growing/shrinking the tables
+            for ( int i = frame % 10; i < boxes.count(); i += 10 )
+            {
+                if ( frame % 20 < 10 )
+                    boxes[i]->resetColor( QskBox::Panel );
+                else
+                    qskSetLocalHints( boxes[i], i );
+            }
+        } );
+
+    const auto exitCode = benchmark.exec( app.arguments() );
+    qskPrintHintStatistics( QskMemoryStatistics( &window ) );
+
+    return exitCode;
+}
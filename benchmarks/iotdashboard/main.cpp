@@ -0,0 +1,132 @@
+/******************************************************************************
+ * QSkinny - Copyright (C) The authors
+ *           SPDX-License-Identifier: BSD-3-Clause
+ *****************************************************************************/
+
+#include "MainItem.h"
+#include "GraphicProvider.h"
+#include "Skin.h"
+
+#include <Benchmark.h>
+
+#include <QskScrollArea.h>
+#include <QskSetup.h>
+#include <QskSkinFactory.h>
+#include <QskSkinManager.h>
+#include <QskWindow.h>
+
+#include <QGuiApplication>
+
+namespace
+{
+    class SkinFactory : public QskSkinFactory
+    {
+        Q_OBJECT
+
+      public:
+        SkinFactory( QObject* parent = nullptr )
+            : QskSkinFactory( parent )
+        {
+        }
+
+        QStringList skinNames() const override
+        {
+            return { "DaytimeSkin", "NighttimeSkin" };
+        }
+
+        QskSkin* createSkin( const QString& skinName ) override
+        {
+            if( skinName == "DaytimeSkin" )
+                return new DaytimeSkin;
+
+            if( skinName == "NighttimeSkin" )
+                return new NighttimeSkin;
+
+            return nullptr;
+        }
+    };
+}
+
+int main( int argc, char* argv[] )
+{
+    Benchmark::initEnvironment();
+
+    QGuiApplication app( argc, argv );
+
+    qskSetup->setItemUpdateFlag( QskQuickItem::PreferRasterForTextures, true );
+
+    Qsk::addGraphicProvider( QString(), new GraphicProvider() );
+
+    qskSkinManager->setPluginPaths( QStringList() ); // no plugins
+    qskSkinManager->unregisterFactory( "material3factory" );
+    qskSkinManager->unregisterFactory( "squiekfactory" );
+    qskSkinManager->unregisterFactory( "fluent2factory" );
+
+    qskSkinManager->registerFactory(
+        QStringLiteral( "SampleSkinFactory" ), new SkinFactory() );
+
+    qskSetup->setSkin( "DaytimeSkin" );
+
+    /*
+        Like MainWindow, but with the dashboard being inside of a scroll area,
+        so that we have something to scroll, when shrinking the window.
+     */
+    const QSizeF dashboardSize( 1024, 600 );
+
+    auto mainItem = new MainItem();
+    mainItem->setFixedSize( dashboardSize );
+
+    auto scrollArea = new QskScrollArea();
+    scrollArea->setScrolledItem( mainItem );
+
+    QskWindow window;
+    window.addItem( scrollArea );
+    window.resize( dashboardSize.toSize() );
+
+    auto cube = mainItem->findChild< Cube* >();
+
+    Benchmark benchmark( "iotdashboard", &window );
+
+    benchmark.addScenario( "idle", 120, []( int ) {} );
+
+    if ( cube )
+    {
+        benchmark.addScenario( "page transitions", 300,
+            [ cube ]( int frame )
+            {
+                // giving the cube animation some frames to finish
+                if ( frame % 30 == 0 )
+                {
+                    const auto position = static_cast< Cube::Position >(
+                        ( frame / 30 ) % Cube::NumPositions );
+
+                    cube->switchToPosition( position );
+                }
+            } );
+    }
+
+    benchmark.addScenario( "skin switching", 100,
+        []( int frame )
+        {
+            if ( frame % 10 == 0 )
+                qskSetup->setSkin( ( frame / 10 ) % 2 ? "NighttimeSkin" : "DaytimeSkin" );
+        } );
+
+    // the last scenario, as it shrinks the window
+    benchmark.addScenario( "scrolling", 300,
+        [ &window, scrollArea ]( int frame )
+        {
+            window.resize( 640, 360 );
+
+            const auto size = scrollArea->scrollableSize();
+            const auto ratio = ( frame % 60 ) / 59.0;
+
+            // diagonally forth and back
+            const auto pos = ( frame / 60 ) % 2 ? 1.0 - ratio : ratio;
+            scrollArea->setScrollPos( QPointF( pos * size.width(), pos * size.height() ) );
+        } );
+
+    return benchmark.exec( app.arguments() );
+}
+
+#include "main.moc"
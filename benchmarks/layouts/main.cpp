@@ -0,0 +1,77 @@
+/******************************************************************************
+ * QSkinny - Copyright (C) The authors
+ *           SPDX-License-Identifier: BSD-3-Clause
+ *****************************************************************************/
+
+#include "DynamicConstraintsPage.h"
+#include "FlowLayoutPage.h"
+#include "LinearLayoutPage.h"
+#include "GridLayoutPage.h"
+#include "StackLayoutPage.h"
+#include "SwipeViewPage.h"
+
+#include <Benchmark.h>
+#include <SkinnyNamespace.h>
+
+#include <QskBox.h>
+#include <QskSkinManager.h>
+#include <QskTabView.h>
+#include <QskWindow.h>
+
+#include <QGuiApplication>
+
+int main( int argc, char* argv[] )
+{
+    Benchmark::initEnvironment();
+
+    QGuiApplication app( argc, argv );
+
+    auto tabView = new QskTabView();
+    tabView->setMargins( 10 );
+    tabView->setTabBarEdge( Qt::LeftEdge );
+    tabView->setAutoFitTabs( true );
+
+    tabView->addTab( "Grid Layout", new GridLayoutPage() );
+    tabView->addTab( "Flow Layout", new FlowLayoutPage() );
+    tabView->addTab( "Linear Layout", new LinearLayoutPage() );
+    tabView->addTab( "Dynamic\nConstraints", new DynamicConstraintsPage() );
+    tabView->addTab( "Stack Layout", new StackLayoutPage() );
+    tabView->addTab( "Swipe View", new SwipeViewPage() );
+
+    auto box = new QskBox();
+    box->setAutoLayoutChildren( true );
+    tabView->setParentItem( box );
+
+    QskWindow window;
+    window.addItem( box );
+    window.resize( 800, 600 );
+
+    Benchmark benchmark( "layouts", &window );
+
+    benchmark.addScenario( "page transitions", 300,
+        [ tabView ]( int frame )
+        {
+            if ( frame % 10 == 0 )
+                tabView->setCurrentIndex( ( frame / 10 ) % tabView->count() );
+        } );
+
+    benchmark.addScenario( "resizing", 300,
+        [ &window ]( int frame )
+        {
+            const int offset = ( frame % 60 ) * 5;
+            window.resize( 800 - offset, 600 - offset / 2 );
+        } );
+
+    benchmark.addScenario( "skin switching", 100,
+        []( int frame )
+        {
+            if ( frame % 10 == 0 )
+            {
+                const auto count = qskSkinManager->skinNames().count();
+                if ( count > 0 )
+                    Skinny::setSkin( ( frame / 10 ) % count, 0 );
+            }
+        } );
+
+    return benchmark.exec( app.arguments() );
+}
@@ -0,0 +1,132 @@
+/******************************************************************************
+ * QSkinny - Copyright (C) The authors
+ *           SPDX-License-Identifier: BSD-3-Clause
+ *****************************************************************************/
+
+#include <Benchmark.h>
+
+#include <QskMenu.h>
+#include <QskMenuSkinlet.h>
+#include <QskSetup.h>
+#include <QskWindow.h>
+
+#include <QGuiApplication>
+#include <QHoverEvent>
+#include <QStringList>
+
+#include <cstdio>
+
+/*
+    Moving the mouse over a menu changes the Hovered state of 2 samples
+    only. So each frame should update the nodes of these samples only
+    - for each of the Segment, Icon and Text subcontrols.
+
+    The options have no icons, so that the Icon samples have no nodes.
+    The benchmark fails, when more samples are updated.
+ */
+
+static const int optionCount = 20;
+
+namespace
+{
+    class MenuSkinlet final : public QskMenuSkinlet
+    {
+      public:
+        MenuSkinlet( QskSkin* skin )
+            : QskMenuSkinlet( skin )
+        {
+        }
+
+        int takeSampleUpdates() const
+        {
+            const auto count = m_sampleUpdates;
+            m_sampleUpdates = 0;
+
+            return count;
+        }
+
+      protected:
+        QSGNode* updateSampleNode( const QskSkinnable* skinnable,
+            QskAspect::Subcontrol subControl, int index, QSGNode* node ) const override
+        {
+            m_sampleUpdates++;
+
+            return QskMenuSkinlet::updateSampleNode(
+                skinnable, subControl, index, node );
+        }
+
+      private:
+        mutable int m_sampleUpdates = 0;
+    };
+}
+
+static void qskHover( QskMenu* menu, const QPointF& pos, const QPointF& oldPos )
+{
+#if QT_VERSION >= QT_VERSION_CHECK( 6, 3, 0 )
+    QHoverEvent event( QEvent::HoverMove, pos, menu->mapToGlobal( pos ), oldPos );
+#else
+    QHoverEvent event( QEvent::HoverMove, pos, oldPos );
+#endif
+
+    QCoreApplication::sendEvent( menu, &event );
+}
+
+int main( int argc, char* argv[] )
+{
+    Benchmark::initEnvironment();
+
+    QGuiApplication app( argc, argv );
+
+    QskWindow window;
+    window.resize( 800, 600 );
+
+    QStringList options;
+    for ( int i = 0; i < optionCount; i++ )
+        options += QStringLiteral( "Option %1" ).arg( i + 1 );
+
+    auto menu = new QskMenu( window.contentItem() );
+    menu->setOptions( options );
+
+    auto skinlet = new MenuSkinlet( qskSetup->skin() );
+    skinlet->setOwnedBySkinnable( true );
+
+    menu->setSkinlet( skinlet );
+    menu->open();
+
+    const int maxSampleUpdates = 2 * 3; // Segment, Icon, Text
+    int sampleUpdates = 0;
+
+    bool isSteady = false;
+
+    Benchmark benchmark( "menu", &window );
+
+    benchmark.addScenario( "hover changes", 200,
+        [ & ]( int frame )
+        {
+            // the updates of the previous frame
+            const auto count = skinlet->takeSampleUpdates();
+
+            if ( isSteady )
+                sampleUpdates = qMax( sampleUpdates, count );
+
+            const auto index = frame % optionCount;
+            const auto oldIndex = ( index + optionCount - 1 ) % optionCount;
+
+            qskHover( menu, menu->cellRect( index ).center(),
+                menu->cellRect( oldIndex ).center() );
+
+            // fading or animated hints result in updating all samples
+            isSteady = ( frame > 1 ) && !menu->isFading()
+                && !menu->hasRunningHintAnimators();
+        } );
+
+    auto exitCode = benchmark.exec( app.arguments() );
+
+    std::printf( "%d sample updates per frame ( expected: %d at most )\n",
+        sampleUpdates, maxSampleUpdates );
+
+    if ( exitCode == 0 && sampleUpdates > maxSampleUpdates )
+        exitCode = 1;
+
+    return exitCode;
+}
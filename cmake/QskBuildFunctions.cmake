@@ -104,6 +104,19 @@ function(qsk_add_example target)
 
 endfunction()
 
+function(qsk_add_benchmark target)
+
+    qsk_add_executable(${target} ${ARGN})
+
+    set_target_properties(${target} PROPERTIES FOLDER benchmarks)
+
+    target_link_libraries(${target} PRIVATE qskinny qsktestsupport qskbenchmark)
+
+    # for benchmarks with subdirectories
+    target_include_directories(${target} PRIVATE ${CMAKE_CURRENT_LIST_DIR})
+
+endfunction()
+
 function(qsk_add_shaders target)
 
     cmake_parse_arguments( arg "" "" "FILES" ${ARGN} )
@@ -101,6 +101,8 @@
 #include <QGuiApplication>
 #include <QScreen>
 
+#include <memory>
+
 namespace
 {
     inline QFont createFont( const QString& name, qreal lineHeight,
@@ -191,8 +193,9 @@ namespace
         {
         }
 
-        void setupMetrics();
-        void setupColors( QskAspect::Section, const QskFluent2Theme& );
+        // the hints of each control are set up, when being needed
+        static void declareMetrics( QskSkin* );
+        static void declareColors( QskSkin*, QskAspect::Section, const QskFluent2Theme& );
 
       private:
         void setupPopup( const QskFluent2Theme& );
@@ -301,73 +304,114 @@ namespace
     };
 }
 
-void Editor::setupMetrics()
+void Editor::declareMetrics( QskSkin* skin )
 {
-    setupBoxMetrics();
-    setupCheckBoxMetrics();
-    setupComboBoxMetrics();
-    setupDialogButtonBoxMetrics();
-    setupDrawerMetrics();
-    setupFocusIndicatorMetrics();
-    setupGraphicLabelMetrics();
-    setupListViewMetrics();
-    setupMenuMetrics();
-    setupPageIndicatorMetrics();
-    setupProgressBarMetrics();
-    setupProgressRingMetrics();
-    setupPushButtonMetrics();
-    setupRadioBoxMetrics();
-    setupScrollViewMetrics();
-    setupSegmentedBarMetrics();
-    setupSeparatorMetrics();
-    setupSliderMetrics();
-    setupSpinBoxMetrics();
-    setupSwitchButtonMetrics();
-    setupTabButtonMetrics();
-    setupTabBarMetrics();
-    setupTabViewMetrics();
-    setupTextInputMetrics();
-    setupTextLabelMetrics();
-    setupVirtualKeyboardMetrics();
+    const auto hintSetup = []( void ( Editor::*setup )() )
+    {
+        return [setup]( QskSkinHintTable& table )
+        {
+            Editor editor( &table );
+            ( editor.*setup )();
+        };
+    };
+
+    skin->declareHints< QskBox >( hintSetup( &Editor::setupBoxMetrics ) );
+    skin->declareHints< QskCheckBox >( hintSetup( &Editor::setupCheckBoxMetrics ) );
+    skin->declareHints< QskComboBox >( hintSetup( &Editor::setupComboBoxMetrics ) );
+    skin->declareHints< QskDialogButtonBox >( hintSetup( &Editor::setupDialogButtonBoxMetrics ) );
+    skin->declareHints< QskDrawer >( hintSetup( &Editor::setupDrawerMetrics ) );
+    skin->declareHints< QskFocusIndicator >( hintSetup( &Editor::setupFocusIndicatorMetrics ) );
+    skin->declareHints< QskGraphicLabel >( hintSetup( &Editor::setupGraphicLabelMetrics ) );
+    skin->declareHints< QskListView >( hintSetup( &Editor::setupListViewMetrics ) );
+    skin->declareHints< QskMenu >( hintSetup( &Editor::setupMenuMetrics ) );
+    skin->declareHints< QskPageIndicator >( hintSetup( &Editor::setupPageIndicatorMetrics ) );
+    skin->declareHints< QskProgressBar >( hintSetup( &Editor::setupProgressBarMetrics ) );
+    skin->declareHints< QskProgressRing >( hintSetup( &Editor::setupProgressRingMetrics ) );
+    skin->declareHints< QskPushButton >( hintSetup( &Editor::setupPushButtonMetrics ) );
+    skin->declareHints< QskRadioBox >( hintSetup( &Editor::setupRadioBoxMetrics ) );
+    skin->declareHints< QskScrollView >( hintSetup( &Editor::setupScrollViewMetrics ) );
+    skin->declareHints< QskSegmentedBar >( hintSetup( &Editor::setupSegmentedBarMetrics ) );
+    skin->declareHints< QskSeparator >( hintSetup( &Editor::setupSeparatorMetrics ) );
+    skin->declareHints< QskSlider >( hintSetup( &Editor::setupSliderMetrics ) );
+    skin->declareHints< QskSpinBox >( hintSetup( &Editor::setupSpinBoxMetrics ) );
+    skin->declareHints< QskSwitchButton >( hintSetup( &Editor::setupSwitchButtonMetrics ) );
+    skin->declareHints< QskTabButton >( hintSetup( &Editor::setupTabButtonMetrics ) );
+    skin->declareHints< QskTabBar >( hintSetup( &Editor::setupTabBarMetrics ) );
+    skin->declareHints< QskTabView >( hintSetup( &Editor::setupTabViewMetrics ) );
+    skin->declareHints< QskTextInput >( hintSetup( &Editor::setupTextInputMetrics ) );
+    skin->declareHints< QskTextLabel >( hintSetup( &Editor::setupTextLabelMetrics ) );
+    skin->declareHints< QskVirtualKeyboard >( hintSetup( &Editor::setupVirtualKeyboardMetrics ) );
 }
 
-void Editor::setupColors( QskAspect::Section section, const QskFluent2Theme& theme )
+void Editor::declareColors( QskSkin* skin,
+    QskAspect::Section section, const QskFluent2Theme& theme )
 {
+    // the setup functions might be called later, when the theme is gone
+    const auto pTheme = std::make_shared< const QskFluent2Theme >( theme );
+
+    const auto colorSetup = [section, pTheme](
+        void ( Editor::*setup )( QskAspect::Section, const QskFluent2Theme& ) )
+    {
+        return [section, pTheme, setup]( QskSkinHintTable& table )
+        {
+            Editor editor( &table );
+            ( editor.*setup )( section, *pTheme );
+        };
+    };
+
+    const auto themeSetup = [pTheme]( void ( Editor::*setup )( const QskFluent2Theme& ) )
+    {
+        return [pTheme, setup]( QskSkinHintTable& table )
+        {
+            Editor editor( &table );
+            ( editor.*setup )( *pTheme );
+        };
+    };
+
+    const auto metricsSetup = []( void ( Editor::*setup )() )
+    {
+        return [setup]( QskSkinHintTable& table )
+        {
+            Editor editor( &table );
+            ( editor.*setup )();
+        };
+    };
+
     if ( section == QskAspect::Body )
     {
         // TODO
-        setupPopup( theme );
-        setupSubWindow( theme );
+        skin->declareHints< QskPopup >( themeSetup( &Editor::setupPopup ) );
+        skin->declareHints< QskSubWindow >( themeSetup( &Editor::setupSubWindow ) );
     }
 
-    setupBoxColors( section, theme );
-    setupCheckBoxColors( section, theme );
-    setupComboBoxColors( section, theme );
-    setupDialogButtonBoxColors( section, theme );
-    setupDrawerColors( section, theme );
-    setupFocusIndicatorColors( section, theme );
-    setupGraphicLabelColors( section, theme );
-    setupGraphicLabelMetrics();
-    setupListViewColors( section, theme );
-    setupMenuColors( section, theme );
-    setupPageIndicatorColors( section, theme );
-    setupProgressBarColors( section, theme );
-    setupProgressRingColors( section, theme );
-    setupPushButtonColors( section, theme );
-    setupRadioBoxColors( section, theme );
-    setupScrollViewColors( section, theme );
-    setupSegmentedBarColors( section, theme );
-    setupSeparatorColors( section, theme );
-    setupSliderColors( section, theme );
-    setupSwitchButtonColors( section, theme );
-    setupSpinBoxColors( section, theme );
-    setupTabButtonColors( section, theme );
-    setupTabBarColors( section, theme );
-    setupTabViewColors( section, theme );
-    setupTextInputColors( section, theme );
-    setupTextLabelColors( section, theme );
-    setupVirtualKeyboardColors( section, theme );
-};
+    skin->declareHints< QskBox >( colorSetup( &Editor::setupBoxColors ) );
+    skin->declareHints< QskCheckBox >( colorSetup( &Editor::setupCheckBoxColors ) );
+    skin->declareHints< QskComboBox >( colorSetup( &Editor::setupComboBoxColors ) );
+    skin->declareHints< QskDialogButtonBox >( colorSetup( &Editor::setupDialogButtonBoxColors ) );
+    skin->declareHints< QskDrawer >( colorSetup( &Editor::setupDrawerColors ) );
+    skin->declareHints< QskFocusIndicator >( colorSetup( &Editor::setupFocusIndicatorColors ) );
+    skin->declareHints< QskGraphicLabel >( colorSetup( &Editor::setupGraphicLabelColors ) );
+    skin->declareHints< QskGraphicLabel >( metricsSetup( &Editor::setupGraphicLabelMetrics ) );
+    skin->declareHints< QskListView >( colorSetup( &Editor::setupListViewColors ) );
+    skin->declareHints< QskMenu >( colorSetup( &Editor::setupMenuColors ) );
+    skin->declareHints< QskPageIndicator >( colorSetup( &Editor::setupPageIndicatorColors ) );
+    skin->declareHints< QskProgressBar >( colorSetup( &Editor::setupProgressBarColors ) );
+    skin->declareHints< QskProgressRing >( colorSetup( &Editor::setupProgressRingColors ) );
+    skin->declareHints< QskPushButton >( colorSetup( &Editor::setupPushButtonColors ) );
+    skin->declareHints< QskRadioBox >( colorSetup( &Editor::setupRadioBoxColors ) );
+    skin->declareHints< QskScrollView >( colorSetup( &Editor::setupScrollViewColors ) );
+    skin->declareHints< QskSegmentedBar >( colorSetup( &Editor::setupSegmentedBarColors ) );
+    skin->declareHints< QskSeparator >( colorSetup( &Editor::setupSeparatorColors ) );
+    skin->declareHints< QskSlider >( colorSetup( &Editor::setupSliderColors ) );
+    skin->declareHints< QskSwitchButton >( colorSetup( &Editor::setupSwitchButtonColors ) );
+    skin->declareHints< QskSpinBox >( colorSetup( &Editor::setupSpinBoxColors ) );
+    skin->declareHints< QskTabButton >( colorSetup( &Editor::setupTabButtonColors ) );
+    skin->declareHints< QskTabBar >( colorSetup( &Editor::setupTabBarColors ) );
+    skin->declareHints< QskTabView >( colorSetup( &Editor::setupTabViewColors ) );
+    skin->declareHints< QskTextInput >( colorSetup( &Editor::setupTextInputColors ) );
+    skin->declareHints< QskTextLabel >( colorSetup( &Editor::setupTextLabelColors ) );
+    skin->declareHints< QskVirtualKeyboard >( colorSetup( &Editor::setupVirtualKeyboardColors ) );
+}
 
 void Editor::setupBoxMetrics()
 {
@@ -1945,8 +1989,7 @@ QskFluent2Skin::QskFluent2Skin( QObject* parent )
 {
     setupFonts();
 
-    Editor editor( &hintTable() );
-    editor.setupMetrics();
+    Editor::declareMetrics( this );
 }
 
 void QskFluent2Skin::addTheme( QskAspect::Section section, const QskFluent2Theme& theme )
@@ -1957,8 +2000,7 @@ void QskFluent2Skin::addTheme( QskAspect::Section section, const QskFluent2Theme
         setupGraphicFilters( theme );
     }
 
-    Editor editor( &hintTable() );
-    editor.setupColors( section, theme );
+    Editor::declareColors( this, section, theme );
 }
 
 QskFluent2Skin::~QskFluent2Skin()
@@ -0,0 +1,156 @@
+/******************************************************************************
+ * QSkinny - Copyright (C) The authors
+ *           SPDX-License-Identifier: BSD-3-Clause
+ *****************************************************************************/
+
+#include <QskTonalPalette.h>
+
+/*
+    The tonal palettes of the default QskMaterial3Theme::BaseColors.
+    They have been generated by tools/tonalpalettes and need to be
+    regenerated, when the seeds or the HCT conversion are changed.
+ */
+static const QRgb qskTables[][ QskTonalPalette::ToneCount ] =
+{
+    {
+        // primary: 0xff6750a4
+        0xff000000, 0xff05001b, 0xff0a0028, 0xff0f0032, 0xff13003a, 0xff160041,
+        0xff190048, 0xff1b004d, 0xff1d0053, 0xff200058, 0xff22005d, 0xff24025f,
+        0xff260661, 0xff280963, 0xff2a0d65, 0xff2d1067, 0xff2f1369, 0xff31166b,
+        0xff33196e, 0xff351c70, 0xff381e72, 0xff3a2174, 0xff3c2377, 0xff3e2679,
+        0xff41287b, 0xff432b7e, 0xff452d80, 0xff483083, 0xff4a3285, 0xff4c3588,
+        0xff4f378a, 0xff513a8d, 0xff533c8f, 0xff563f92, 0xff584194, 0xff5b4397,
+        0xff5d4699, 0xff5f489c, 0xff624b9f, 0xff644da1, 0xff6750a4, 0xff6952a6,
+        0xff6c55a9, 0xff6e57ac, 0xff715aae, 0xff735cb1, 0xff765fb4, 0xff7861b7,
+        0xff7b64b9, 0xff7e66bc, 0xff8069bf, 0xff836bc1, 0xff856ec4, 0xff8870c7,
+        0xff8b73ca, 0xff8d76cd, 0xff9078cf, 0xff927bd2, 0xff957dd5, 0xff9880d8,
+        0xff9a83db, 0xff9d85de, 0xffa088e0, 0xffa28ae3, 0xffa58de6, 0xffa890e9,
+        0xffab92ec, 0xffad95ef, 0xffb098f2, 0xffb39af5, 0xffb69df7, 0xffb8a0fa,
+        0xffbba2fd, 0xffbea5ff, 0xffc0a9ff, 0xffc3acff, 0xffc5afff, 0xffc8b3ff,
+        0xffcab6ff, 0xffcdb9ff, 0xffcfbcff, 0xffd2c0ff, 0xffd4c3ff, 0xffd7c6ff,
+        0xffd9caff, 0xffdccdff, 0xffded0ff, 0xffe1d3ff, 0xffe4d7ff, 0xffe6daff,
+        0xffe9ddff, 0xffebe0ff, 0xffeee4ff, 0xfff0e7ff, 0xfff3eaff, 0xfff6eeff,
+        0xfff8f1ff, 0xfffbf4ff, 0xfffdf7ff, 0xfffffbff, 0xffffffff,
+    },
+    {
+        // secondary: 0xff625b71
+        0xff000000, 0xff050211, 0xff090516, 0xff0d081a, 0xff100b1d, 0xff130e20,
+        0xff161023, 0xff181325, 0xff1a1527, 0xff1c1729, 0xff1e192b, 0xff201b2d,
+        0xff221d2f, 0xff241f32, 0xff262134, 0xff282336, 0xff2a2538, 0xff2d273a,
+        0xff2f293d, 0xff312b3f, 0xff332d41, 0xff352f43, 0xff383246, 0xff3a3448,
+        0xff3c364a, 0xff3e384d, 0xff413a4f, 0xff433d51, 0xff453f54, 0xff484156,
+        0xff4a4358, 0xff4c465b, 0xff4f485d, 0xff514a60, 0xff534d62, 0xff564f65,
+        0xff585167, 0xff5b5469, 0xff5d566c, 0xff5f596e, 0xff625b71, 0xff645d73,
+        0xff676076, 0xff696278, 0xff6c657b, 0xff6e677e, 0xff716a80, 0xff736c83,
+        0xff766e85, 0xff787188, 0xff7b738a, 0xff7e768d, 0xff807890, 0xff837b92,
+        0xff857d95, 0xff888098, 0xff8b839a, 0xff8d859d, 0xff90889f, 0xff928aa2,
+        0xff958da5, 0xff988fa7, 0xff9a92aa, 0xff9d95ad, 0xffa097b0, 0xffa29ab2,
+        0xffa59db5, 0xffa89fb8, 0xffaba2bb, 0xffada5bd, 0xffb0a7c0, 0xffb3aac3,
+        0xffb6adc6, 0xffb8afc8, 0xffbbb2cb, 0xffbeb5ce, 0xffc1b7d1, 0xffc3bad3,
+        0xffc6bdd6, 0xffc9c0d9, 0xffccc2dc, 0xffcfc5df, 0xffd1c8e2, 0xffd4cbe4,
+        0xffd7cde7, 0xffdad0ea, 0xffddd3ed, 0xffe0d6f0, 0xffe3d8f3, 0xffe5dbf6,
+        0xffe8def9, 0xffebe1fb, 0xffeee4fe, 0xfff1e7ff, 0xfff3eaff, 0xfff6edff,
+        0xfff8f1ff, 0xfffbf4ff, 0xfffef7ff, 0xfffffbff, 0xffffffff,
+    },
+    {
+        // tertiary: 0xff7d5260
+        0xff000000, 0xff0f0004, 0xff170109, 0xff1c020c, 0xff200410, 0xff240612,
+        0xff270915, 0xff290b17, 0xff2c0d19, 0xff2e0f1b, 0xff31111d, 0xff33131f,
+        0xff361521, 0xff381723, 0xff3a1925, 0xff3d1b27, 0xff3f1d29, 0xff421f2c,
+        0xff44212e, 0xff472330, 0xff492532, 0xff4c2734, 0xff4e2936, 0xff512c39,
+        0xff532e3b, 0xff56303d, 0xff58323f, 0xff5b3442, 0xff5d3744, 0xff603946,
+        0xff633b48, 0xff653d4b, 0xff68404d, 0xff6a424f, 0xff6d4452, 0xff704654,
+        0xff724956, 0xff754b59, 0xff784d5b, 0xff7a505e, 0xff7d5260, 0xff805462,
+        0xff825765, 0xff855967, 0xff885c6a, 0xff8b5e6c, 0xff8d606f, 0xff906371,
+        0xff936574, 0xff966876, 0xff986a79, 0xff9b6d7b, 0xff9e6f7e, 0xffa17280,
+        0xffa37483, 0xffa67785, 0xffa97988, 0xffac7c8b, 0xffaf7e8d, 0xffb18190,
+        0xffb48392, 0xffb78695, 0xffba8898, 0xffbd8b9a, 0xffc08e9d, 0xffc3909f,
+        0xffc593a2, 0xffc895a5, 0xffcb98a7, 0xffce9baa, 0xffd19dad, 0xffd4a0af,
+        0xffd7a2b2, 0xffdaa5b5, 0xffdda8b8, 0xffe0aaba, 0xffe3adbd, 0xffe6b0c0,
+        0xffe9b3c3, 0xffebb5c5, 0xffeeb8c8, 0xfff1bbcb, 0xfff4bdce, 0xfff7c0d0,
+        0xfffac3d3, 0xfffdc6d6, 0xffffc9d9, 0xffffcddb, 0xffffd1de, 0xffffd5e0,
+        0xffffd9e3, 0xffffdde5, 0xffffe1e8, 0xffffe4eb, 0xffffe8ed, 0xffffecf0,
+        0xfffff0f2, 0xfffff4f5, 0xfffff8f8, 0xfffffbff, 0xffffffff,
+    },
+    {
+        // error: 0xffb3261e
+        0xff000000, 0xff100000, 0xff1a0000, 0xff210000, 0xff280000, 0xff2d0000,
+        0xff310001, 0xff360001, 0xff390001, 0xff3d0001, 0xff410001, 0xff450001,
+        0xff490001, 0xff4d0001, 0xff500001, 0xff540002, 0xff580002, 0xff5c0002,
+        0xff600002, 0xff650002, 0xff690003, 0xff6d0003, 0xff710003, 0xff750003,
+        0xff790004, 0xff7e0004, 0xff820004, 0xff860004, 0xff8a0005, 0xff8e0407,
+        0xff910809, 0xff950c0b, 0xff980f0e, 0xff9c1310, 0xff9f1612, 0xffa31914,
+        0xffa61c16, 0xffaa1f18, 0xffad211a, 0xffb1241d, 0xffb4271f, 0xffb82921,
+        0xffbb2c23, 0xffbf2f25, 0xffc23127, 0xffc63429, 0xffc9362b, 0xffcd392e,
+        0xffd03b30, 0xffd43e32, 0xffd74034, 0xffdb4336, 0xffde4538, 0xffe2483b,
+        0xffe54a3d, 0xffe94d3f, 0xffec4f41, 0xfff05243, 0xfff35546, 0xfff75748,
+        0xfffa5a4a, 0xfffe5c4c, 0xffff6151, 0xffff6757, 0xffff6c5c, 0xffff7162,
+        0xffff7767, 0xffff7c6c, 0xffff8071, 0xffff8576, 0xffff8a7b, 0xffff8e80,
+        0xffff9385, 0xffff9789, 0xffff9b8e, 0xffff9f93, 0xffffa497, 0xffffa89c,
+        0xffffaca1, 0xffffb0a5, 0xffffb4aa, 0xffffb8ae, 0xffffbcb2, 0xffffc0b7,
+        0xffffc3bb, 0xffffc7c0, 0xffffcbc4, 0xffffcfc8, 0xffffd3cd, 0xffffd6d1,
+        0xffffdad5, 0xffffded9, 0xffffe2dd, 0xffffe5e2, 0xffffe9e6, 0xffffedea,
+        0xfffff0ee, 0xfffff4f2, 0xfffff8f7, 0xfffffbff, 0xffffffff,
+    },
+    {
+        // neutral: 0xff605d62
+        0xff000000, 0xff040306, 0xff08070a, 0xff0c0a0e, 0xff0f0e11, 0xff121014,
+        0xff141317, 0xff161519, 0xff18171b, 0xff1a191d, 0xff1c1b1f, 0xff1f1d21,
+        0xff211f23, 0xff232125, 0xff252327, 0xff272529, 0xff29272b, 0xff2b292e,
+        0xff2d2b30, 0xff2f2d32, 0xff322f34, 0xff343236, 0xff363438, 0xff38363b,
+        0xff3b383d, 0xff3d3a3f, 0xff3f3d41, 0xff413f44, 0xff444146, 0xff464348,
+        0xff48464a, 0xff4b484d, 0xff4d4a4f, 0xff4f4d51, 0xff524f54, 0xff545156,
+        0xff575459, 0xff59565b, 0xff5b585d, 0xff5e5b60, 0xff605d62, 0xff636065,
+        0xff656267, 0xff68646a, 0xff6a676c, 0xff6d696e, 0xff6f6c71, 0xff726e73,
+        0xff747176, 0xff777378, 0xff79767b, 0xff7c787e, 0xff7e7b80, 0xff817d83,
+        0xff848085, 0xff868288, 0xff89858a, 0xff8b888d, 0xff8e8a8f, 0xff918d92,
+        0xff938f95, 0xff969297, 0xff99959a, 0xff9b979d, 0xff9e9a9f, 0xffa19ca2,
+        0xffa39fa5, 0xffa6a2a7, 0xffa9a4aa, 0xffaba7ad, 0xffaeaaaf, 0xffb1acb2,
+        0xffb4afb5, 0xffb6b2b7, 0xffb9b4ba, 0xffbcb7bd, 0xffbfbac0, 0xffc1bdc2,
+        0xffc4bfc5, 0xffc7c2c8, 0xffcac5cb, 0xffcdc8cd, 0xffcfcad0, 0xffd2cdd3,
+        0xffd5d0d6, 0xffd8d3d8, 0xffdbd5db, 0xffded8de, 0xffe0dbe1, 0xffe3dee4,
+        0xffe6e1e7, 0xffe9e4e9, 0xffece6ec, 0xffefe9ef, 0xfff2ecf2, 0xfff5eff5,
+        0xfff8f2f8, 0xfffaf5fb, 0xfffdf8fd, 0xfffffbff, 0xffffffff,
+    },
+    {
+        // neutralVariant: 0xff605d66
+        0xff000000, 0xff040308, 0xff08070d, 0xff0b0a11, 0xff0f0d14, 0xff111017,
+        0xff14121a, 0xff16151c, 0xff18171e, 0xff1a1920, 0xff1c1b22, 0xff1e1d24,
+        0xff201f26, 0xff222128, 0xff24232a, 0xff27252c, 0xff29272f, 0xff2b2931,
+        0xff2d2b33, 0xff2f2d35, 0xff312f37, 0xff343139, 0xff36343c, 0xff38363e,
+        0xff3a3840, 0xff3c3a42, 0xff3f3c45, 0xff413f47, 0xff434149, 0xff46434c,
+        0xff48454e, 0xff4a4850, 0xff4d4a53, 0xff4f4c55, 0xff514f57, 0xff54515a,
+        0xff56535c, 0xff59565f, 0xff5b5861, 0xff5d5b63, 0xff605d66, 0xff625f68,
+        0xff65626b, 0xff67646d, 0xff6a6770, 0xff6c6972, 0xff6f6c75, 0xff716e77,
+        0xff74707a, 0xff76737c, 0xff79757f, 0xff7b7881, 0xff7e7a84, 0xff817d87,
+        0xff838089, 0xff86828c, 0xff88858e, 0xff8b8791, 0xff8e8a94, 0xff908c96,
+        0xff938f99, 0xff96929b, 0xff98949e, 0xff9b97a1, 0xff9e99a3, 0xffa09ca6,
+        0xffa39fa9, 0xffa6a1ab, 0xffa8a4ae, 0xffaba7b1, 0xffaea9b3, 0xffb0acb6,
+        0xffb3afb9, 0xffb6b1bc, 0xffb9b4be, 0xffbbb7c1, 0xffbebac4, 0xffc1bcc7,
+        0xffc4bfc9, 0xffc7c2cc, 0xffc9c4cf, 0xffccc7d2, 0xffcfcad5, 0xffd2cdd7,
+        0xffd5d0da, 0xffd8d2dd, 0xffdad5e0, 0xffddd8e3, 0xffe0dbe5, 0xffe3dee8,
+        0xffe6e0eb, 0xffe9e3ee, 0xffece6f1, 0xffeee9f4, 0xfff1ecf7, 0xfff4eff9,
+        0xfff7f1fc, 0xfffaf4ff, 0xfffdf8ff, 0xfffffbff, 0xffffffff,
+    },
+};
+
+static void qskRegisterPalettes()
+{
+    const QRgb seeds[] =
+    {
+        0xff6750A4, // primary
+        0xff625B71, // secondary
+        0xff7D5260, // tertiary
+        0xffB3261E, // error
+        0xff605D62, // neutral
+        0xff605D66  // neutralVariant
+    };
+
+    static_assert( sizeof( seeds ) / sizeof( seeds[0] )
+        == sizeof( qskTables ) / sizeof( qskTables[0] ), "Missing palettes" );
+
+    for ( size_t i = 0; i < sizeof( seeds ) / sizeof( seeds[0] ); i++ )
+        QskTonalPalette::insertTable( seeds[i], qskTables[i] );
+}
+
+Q_CONSTRUCTOR_FUNCTION( qskRegisterPalettes )
@@ -49,6 +49,7 @@
 #include <QskBoxShapeMetrics.h>
 #include <QskMargins.h>
 #include <QskHctColor.h>
+#include <QskTonalPalette.h>
 #include <QskRgbValue.h>
 
 #include <QskNamespace.h>
@@ -57,6 +58,8 @@
 #include <QGuiApplication>
 #include <QScreen>
 
+#include <memory>
+
 static const int qskDuration = 150;
 
 namespace
@@ -80,7 +83,8 @@ namespace
         {
         }
 
-        void setup();
+        // the hints of each control are set up, when being needed
+        static void declareHints( QskSkin*, const QskMaterial3Theme& );
 
       private:
         void setupBox();
@@ -149,36 +153,48 @@ namespace
     }
 }
 
-void Editor::setup()
+void Editor::declareHints( QskSkin* skin, const QskMaterial3Theme& palette )
 {
-    setupBox();
-    setupCheckBox();
-    setupComboBox();
-    setupDialogButtonBox();
-    setupDrawer();
-    setupFocusIndicator();
-    setupInputPanel();
-    setupVirtualKeyboard();
-    setupListView();
-    setupMenu();
-    setupPageIndicator();
-    setupPopup();
-    setupProgressBar();
-    setupProgressRing();
-    setupPushButton();
-    setupRadioBox();
-    setupScrollView();
-    setupSegmentedBar();
-    setupSeparator();
-    setupSlider();
-    setupSpinBox();
-    setupSubWindow();
-    setupSwitchButton();
-    setupTabButton();
-    setupTabBar();
-    setupTabView();
-    setupTextLabel();
-    setupTextInput();
+    // the setup functions might be called later, when the palette is gone
+    const auto pal = std::make_shared< const QskMaterial3Theme >( palette );
+
+    const auto hintSetup = [pal]( void ( Editor::*setup )() )
+    {
+        return [pal, setup]( QskSkinHintTable& table )
+        {
+            Editor editor( &table, *pal );
+            ( editor.*setup )();
+        };
+    };
+
+    skin->declareHints< QskBox >( hintSetup( &Editor::setupBox ) );
+    skin->declareHints< QskCheckBox >( hintSetup( &Editor::setupCheckBox ) );
+    skin->declareHints< QskComboBox >( hintSetup( &Editor::setupComboBox ) );
+    skin->declareHints< QskDialogButtonBox >( hintSetup( &Editor::setupDialogButtonBox ) );
+    skin->declareHints< QskDrawer >( hintSetup( &Editor::setupDrawer ) );
+    skin->declareHints< QskFocusIndicator >( hintSetup( &Editor::setupFocusIndicator ) );
+    skin->declareHints< QskInputPanelBox >( hintSetup( &Editor::setupInputPanel ) );
+    skin->declareHints< QskVirtualKeyboard >( hintSetup( &Editor::setupVirtualKeyboard ) );
+    skin->declareHints< QskListView >( hintSetup( &Editor::setupListView ) );
+    skin->declareHints< QskMenu >( hintSetup( &Editor::setupMenu ) );
+    skin->declareHints< QskPageIndicator >( hintSetup( &Editor::setupPageIndicator ) );
+    skin->declareHints< QskPopup >( hintSetup( &Editor::setupPopup ) );
+    skin->declareHints< QskProgressBar >( hintSetup( &Editor::setupProgressBar ) );
+    skin->declareHints< QskProgressRing >( hintSetup( &Editor::setupProgressRing ) );
+    skin->declareHints< QskPushButton >( hintSetup( &Editor::setupPushButton ) );
+    skin->declareHints< QskRadioBox >( hintSetup( &Editor::setupRadioBox ) );
+    skin->declareHints< QskScrollView >( hintSetup( &Editor::setupScrollView ) );
+    skin->declareHints< QskSegmentedBar >( hintSetup( &Editor::setupSegmentedBar ) );
+    skin->declareHints< QskSeparator >( hintSetup( &Editor::setupSeparator ) );
+    skin->declareHints< QskSlider >( hintSetup( &Editor::setupSlider ) );
+    skin->declareHints< QskSpinBox >( hintSetup( &Editor::setupSpinBox ) );
+    skin->declareHints< QskSubWindow >( hintSetup( &Editor::setupSubWindow ) );
+    skin->declareHints< QskSwitchButton >( hintSetup( &Editor::setupSwitchButton ) );
+    skin->declareHints< QskTabButton >( hintSetup( &Editor::setupTabButton ) );
+    skin->declareHints< QskTabBar >( hintSetup( &Editor::setupTabBar ) );
+    skin->declareHints< QskTabView >( hintSetup( &Editor::setupTabView ) );
+    skin->declareHints< QskTextLabel >( hintSetup( &Editor::setupTextLabel ) );
+    skin->declareHints< QskTextInput >( hintSetup( &Editor::setupTextInput ) );
 }
 
 void Editor::setupCheckBox()
@@ -1269,124 +1285,154 @@ QskMaterial3Theme::QskMaterial3Theme( QskSkin::ColorScheme colorScheme )
 {
 }
 
+namespace
+{
+    class Tones
+    {
+      public:
+        Tones( QRgb seed )
+            : m_palette( QskTonalPalette::fromCache( seed ) )
+        {
+            if ( m_palette.isNull() )
+                m_hct = QskHctColor( seed );
+        }
+
+        QRgb rgb( int tone ) const
+        {
+            if ( !m_palette.isNull() )
+                return m_palette.rgb( tone );
+
+            /*
+                The theme needs only a few tones of each palette,
+                so we don't calculate all of them for uncached seeds.
+             */
+            return m_hct.toned( tone ).rgb();
+        }
+
+      private:
+        QskTonalPalette m_palette;
+        QskHctColor m_hct;
+    };
+}
+
 QskMaterial3Theme::QskMaterial3Theme( QskSkin::ColorScheme colorScheme,
     const BaseColors& baseColors )
 {
     if ( colorScheme == QskSkin::LightScheme )
     {
         {
-            const QskHctColor color( baseColors.primary );
+            const Tones tones( baseColors.primary );
 
-            primary = color.toned( 40 ).rgb();
-            onPrimary = color.toned( 100 ).rgb();
-            primaryContainer = color.toned( 90 ).rgb();
-            onPrimaryContainer = color.toned( 10 ).rgb();
+            primary = tones.rgb( 40 );
+            onPrimary = tones.rgb( 100 );
+            primaryContainer = tones.rgb( 90 );
+            onPrimaryContainer = tones.rgb( 10 );
         }
 
         {
-            const QskHctColor color( baseColors.secondary );
+            const Tones tones( baseColors.secondary );
 
-            secondary = color.toned( 40 ).rgb();
-            onSecondary = color.toned( 100 ).rgb();
-            secondaryContainer = color.toned( 90 ).rgb();
-            onSecondaryContainer = color.toned( 10 ).rgb();
+            secondary = tones.rgb( 40 );
+            onSecondary = tones.rgb( 100 );
+            secondaryContainer = tones.rgb( 90 );
+            onSecondaryContainer = tones.rgb( 10 );
         }
 
         {
-            const QskHctColor color( baseColors.tertiary );
+            const Tones tones( baseColors.tertiary );
 
-            tertiary = color.toned( 40 ).rgb();
-            onTertiary = color.toned( 100 ).rgb();
-            tertiaryContainer = color.toned( 90 ).rgb();
-            onTertiaryContainer = color.toned( 10 ).rgb();
+            tertiary = tones.rgb( 40 );
+            onTertiary = tones.rgb( 100 );
+            tertiaryContainer = tones.rgb( 90 );
+            onTertiaryContainer = tones.rgb( 10 );
         }
 
         {
-            const QskHctColor color( baseColors.error );
+            const Tones tones( baseColors.error );
 
-            error = color.toned( 40 ).rgb();
-            onError = color.toned( 100 ).rgb();
-            errorContainer = color.toned( 90 ).rgb();
-            onErrorContainer = color.toned( 10 ).rgb();
+            error = tones.rgb( 40 );
+            onError = tones.rgb( 100 );
+            errorContainer = tones.rgb( 90 );
+            onErrorContainer = tones.rgb( 10 );
         }
 
         {
-            const QskHctColor color( baseColors.neutral );
+            const Tones tones( baseColors.neutral );
 
-            background = color.toned( 99 ).rgb();
-            onBackground = color.toned( 10 ).rgb();
-            surface = color.toned( 99 ).rgb();
-            onSurface = color.toned( 10 ).rgb();
-            shadow = color.toned( 0 ).rgb();
+            background = tones.rgb( 99 );
+            onBackground = tones.rgb( 10 );
+            surface = tones.rgb( 99 );
+            onSurface = tones.rgb( 10 );
+            shadow = tones.rgb( 0 );
         }
 
         {
-            const QskHctColor color( baseColors.neutralVariant );
+            const Tones tones( baseColors.neutralVariant );
 
-            surfaceVariant = color.toned( 90 ).rgb();
-            onSurfaceVariant = color.toned( 30 ).rgb();
-            outline = color.toned( 50 ).rgb();
-            outlineVariant = color.toned( 80 ).rgb();
-            surfaceContainerHighest = color.toned( 90 ).rgb();
+            surfaceVariant = tones.rgb( 90 );
+            onSurfaceVariant = tones.rgb( 30 );
+            outline = tones.rgb( 50 );
+            outlineVariant = tones.rgb( 80 );
+            surfaceContainerHighest = tones.rgb( 90 );
         }
 
     }
     else if ( colorScheme == QskSkin::DarkScheme )
     {
         {
-            const QskHctColor color( baseColors.primary );
+            const Tones tones( baseColors.primary );
 
-            primary = color.toned( 80 ).rgb();
-            onPrimary = color.toned( 20 ).rgb();
-            primaryContainer = color.toned( 30 ).rgb();
-            onPrimaryContainer = color.toned( 90 ).rgb();
+            primary = tones.rgb( 80 );
+            onPrimary = tones.rgb( 20 );
+            primaryContainer = tones.rgb( 30 );
+            onPrimaryContainer = tones.rgb( 90 );
         }
 
         {
-            const QskHctColor color( baseColors.secondary );
+            const Tones tones( baseColors.secondary );
 
-            secondary = color.toned( 80 ).rgb();
-            onSecondary = color.toned( 20 ).rgb();
-            secondaryContainer = color.toned( 30 ).rgb();
-            onSecondaryContainer = color.toned( 90 ).rgb();
+            secondary = tones.rgb( 80 );
+            onSecondary = tones.rgb( 20 );
+            secondaryContainer = tones.rgb( 30 );
+            onSecondaryContainer = tones.rgb( 90 );
         }
 
         {
-            const QskHctColor color( baseColors.tertiary );
+            const Tones tones( baseColors.tertiary );
 
-            tertiary = color.toned( 80 ).rgb();
-            onTertiary = color.toned( 20 ).rgb();
-            tertiaryContainer = color.toned( 30 ).rgb();
-            onTertiaryContainer = color.toned( 90 ).rgb();
+            tertiary = tones.rgb( 80 );
+            onTertiary = tones.rgb( 20 );
+            tertiaryContainer = tones.rgb( 30 );
+            onTertiaryContainer = tones.rgb( 90 );
         }
 
         {
-            const QskHctColor color( baseColors.error );
+            const Tones tones( baseColors.error );
 
-            error = color.toned( 80 ).rgb();
-            onError = color.toned( 20 ).rgb();
-            errorContainer = color.toned( 30 ).rgb();
-            onErrorContainer = color.toned( 90 ).rgb();
+            error = tones.rgb( 80 );
+            onError = tones.rgb( 20 );
+            errorContainer = tones.rgb( 30 );
+            onErrorContainer = tones.rgb( 90 );
         }
 
         {
-            const QskHctColor color( baseColors.neutral );
+            const Tones tones( baseColors.neutral );
 
-            background = color.toned( 10 ).rgb();
-            onBackground = color.toned( 90 ).rgb();
-            surface = color.toned( 10 ).rgb();
-            onSurface = color.toned( 80 ).rgb();
-            shadow = color.toned( 0 ).rgb();
+            background = tones.rgb( 10 );
+            onBackground = tones.rgb( 90 );
+            surface = tones.rgb( 10 );
+            onSurface = tones.rgb( 80 );
+            shadow = tones.rgb( 0 );
         }
 
         {
-            const QskHctColor color( baseColors.neutralVariant );
+            const Tones tones( baseColors.neutralVariant );
 
-            surfaceVariant = color.toned( 30 ).rgb();
-            onSurfaceVariant = color.toned( 80 ).rgb();
-            outline = color.toned( 60 ).rgb();
-            outlineVariant = color.toned( 30 ).rgb();
-            surfaceContainerHighest = color.toned( 22 ).rgb();
+            surfaceVariant = tones.rgb( 30 );
+            onSurfaceVariant = tones.rgb( 80 );
+            outline = tones.rgb( 60 );
+            outlineVariant = tones.rgb( 30 );
+            surfaceContainerHighest = tones.rgb( 22 );
         }
     }
 
@@ -1425,8 +1471,7 @@ QskMaterial3Skin::QskMaterial3Skin( const QskMaterial3Theme& palette, QObject* p
     setupFonts();
     setupGraphicFilters( palette );
 
-    Editor editor( &hintTable(), palette );
-    editor.setup();
+    Editor::declareHints( this, palette );
 }
 
 QskMaterial3Skin::~QskMaterial3Skin()
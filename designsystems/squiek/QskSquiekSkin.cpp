@@ -51,6 +51,8 @@
 #include <QskGraphic.h>
 #include <QskStandardSymbol.h>
 
+#include <memory>
+
 static const int qskDuration = 200;
 
 namespace
@@ -144,7 +146,8 @@ namespace
         {
         }
 
-        void setup();
+        // the hints of each control are set up, when being needed
+        static void declareHints( QskSkin*, const ColorPalette& );
 
       private:
         void setupControl();
@@ -271,39 +274,55 @@ void Editor::setPanel( QskAspect aspect, PanelStyle style )
     setButton( aspect, style, 1 );
 }
 
-void Editor::setup()
+void Editor::declareHints( QskSkin* skin, const ColorPalette& palette )
 {
-    setupControl();
-
-    setupBox();
-    setupCheckBox();
-    setupComboBox();
-    setupDialogButtonBox();
-    setupDrawer();
-    setupFocusIndicator();
-    setupInputPanel();
-    setupInputPredictionBar();
-    setupVirtualKeyboard();
-    setupListView();
-    setupMenu();
-    setupPageIndicator();
-    setupPopup();
-    setupProgressBar();
-    setupProgressRing();
-    setupPushButton();
-    setupRadioBox();
-    setupScrollView();
-    setupSegmentedBar();
-    setupSeparator();
-    setupSlider();
-    setupSubWindow();
-    setupSpinBox();
-    setupSwitchButton();
-    setupTabButton();
-    setupTabBar();
-    setupTabView();
-    setupTextLabel();
-    setupTextInput();
+    {
+        // the defaults, that do not belong to a specific control
+        Editor editor( &skin->hintTable(), palette );
+        editor.setupControl();
+    }
+
+    // the setup functions might be called later, when the palette has changed
+    const auto pal = std::make_shared< const ColorPalette >( palette );
+
+    const auto hintSetup = [pal]( void ( Editor::*setup )() )
+    {
+        return [pal, setup]( QskSkinHintTable& table )
+        {
+            Editor editor( &table, *pal );
+            ( editor.*setup )();
+        };
+    };
+
+    skin->declareHints< QskBox >( hintSetup( &Editor::setupBox ) );
+    skin->declareHints< QskCheckBox >( hintSetup( &Editor::setupCheckBox ) );
+    skin->declareHints< QskComboBox >( hintSetup( &Editor::setupComboBox ) );
+    skin->declareHints< QskDialogButtonBox >( hintSetup( &Editor::setupDialogButtonBox ) );
+    skin->declareHints< QskDrawer >( hintSetup( &Editor::setupDrawer ) );
+    skin->declareHints< QskFocusIndicator >( hintSetup( &Editor::setupFocusIndicator ) );
+    skin->declareHints< QskInputPanelBox >( hintSetup( &Editor::setupInputPanel ) );
+    skin->declareHints< QskInputPredictionBar >( hintSetup( &Editor::setupInputPredictionBar ) );
+    skin->declareHints< QskVirtualKeyboard >( hintSetup( &Editor::setupVirtualKeyboard ) );
+    skin->declareHints< QskListView >( hintSetup( &Editor::setupListView ) );
+    skin->declareHints< QskMenu >( hintSetup( &Editor::setupMenu ) );
+    skin->declareHints< QskPageIndicator >( hintSetup( &Editor::setupPageIndicator ) );
+    skin->declareHints< QskPopup >( hintSetup( &Editor::setupPopup ) );
+    skin->declareHints< QskProgressBar >( hintSetup( &Editor::setupProgressBar ) );
+    skin->declareHints< QskProgressRing >( hintSetup( &Editor::setupProgressRing ) );
+    skin->declareHints< QskPushButton >( hintSetup( &Editor::setupPushButton ) );
+    skin->declareHints< QskRadioBox >( hintSetup( &Editor::setupRadioBox ) );
+    skin->declareHints< QskScrollView >( hintSetup( &Editor::setupScrollView ) );
+    skin->declareHints< QskSegmentedBar >( hintSetup( &Editor::setupSegmentedBar ) );
+    skin->declareHints< QskSeparator >( hintSetup( &Editor::setupSeparator ) );
+    skin->declareHints< QskSlider >( hintSetup( &Editor::setupSlider ) );
+    skin->declareHints< QskSubWindow >( hintSetup( &Editor::setupSubWindow ) );
+    skin->declareHints< QskSpinBox >( hintSetup( &Editor::setupSpinBox ) );
+    skin->declareHints< QskSwitchButton >( hintSetup( &Editor::setupSwitchButton ) );
+    skin->declareHints< QskTabButton >( hintSetup( &Editor::setupTabButton ) );
+    skin->declareHints< QskTabBar >( hintSetup( &Editor::setupTabBar ) );
+    skin->declareHints< QskTabView >( hintSetup( &Editor::setupTabView ) );
+    skin->declareHints< QskTextLabel >( hintSetup( &Editor::setupTextLabel ) );
+    skin->declareHints< QskTextInput >( hintSetup( &Editor::setupTextInput ) );
 }
 
 void Editor::setupControl()
@@ -1252,8 +1271,7 @@ QskSquiekSkin::QskSquiekSkin( QObject* parent )
     addGraphicRole( DisabledSymbol, pal.darker200 );
     addGraphicRole( CursorSymbol, pal.highlightedText );
 
-    Editor editor( &hintTable(), pal );
-    editor.setup();
+    Editor::declareHints( this, pal );
 }
 
 QskSquiekSkin::~QskSquiekSkin()
@@ -1264,8 +1282,7 @@ void QskSquiekSkin::resetColors( const QColor& accent )
 {
     m_data->palette = ColorPalette( accent );
 
-    Editor editor( &hintTable(), m_data->palette );
-    editor.setup();
+    Editor::declareHints( this, m_data->palette );
 }
 
 void QskSquiekSkin::addGraphicRole( int role, const QColor& color )
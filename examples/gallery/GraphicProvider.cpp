@@ -0,0 +1,18 @@
+/******************************************************************************
+ * QSkinny - Copyright (C) The authors
+ *           SPDX-License-Identifier: BSD-3-Clause
+ *****************************************************************************/
+
+#include "GraphicProvider.h"
+
+#include <QskGraphic.h>
+#include <QskGraphicIO.h>
+
+const QskGraphic* GraphicProvider::loadGraphic( const QString& id ) const
+{
+    const QString path = QStringLiteral( ":gallery/icons/qvg/" )
+        + id + QStringLiteral( ".qvg" );
+
+    const auto graphic = QskGraphicIO::read( path );
+    return graphic.isNull() ? nullptr : new QskGraphic( graphic );
+}
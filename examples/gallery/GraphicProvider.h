@@ -0,0 +1,14 @@
+/******************************************************************************
+ * QSkinny - Copyright (C) The authors
+ *           SPDX-License-Identifier: BSD-3-Clause
+ *****************************************************************************/
+
+#pragma once
+
+#include <QskGraphicProvider.h>
+
+class GraphicProvider final : public QskGraphicProvider
+{
+  protected:
+    const QskGraphic* loadGraphic( const QString& id ) const override;
+};
@@ -0,0 +1,19 @@
+############################################################################
+# QSkinny - Copyright (C) The authors
+#           SPDX-License-Identifier: BSD-3-Clause
+############################################################################
+
+# shared with benchmarks/gallery
+set(GALLERY_SOURCES
+    label/LabelPage.h label/LabelPage.cpp
+    inputs/InputPage.h inputs/InputPage.cpp
+    progressbar/ProgressBarPage.h progressbar/ProgressBarPage.cpp
+    button/ButtonPage.h button/ButtonPage.cpp
+    selector/SelectorPage.h selector/SelectorPage.cpp
+    dialog/DialogPage.h dialog/DialogPage.cpp
+    listbox/ListBoxPage.h listbox/ListBoxPage.cpp
+    Page.h Page.cpp
+    GraphicProvider.h GraphicProvider.cpp
+    TabView.h TabView.cpp
+)
+list(TRANSFORM GALLERY_SOURCES PREPEND ${CMAKE_CURRENT_LIST_DIR}/)
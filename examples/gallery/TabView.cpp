@@ -0,0 +1,52 @@
+/******************************************************************************
+ * QSkinny - Copyright (C) The authors
+ *           SPDX-License-Identifier: BSD-3-Clause
+ *****************************************************************************/
+
+#include "TabView.h"
+
+#include <QskBoxBorderMetrics.h>
+#include <QskBoxShapeMetrics.h>
+#include <QskGradient.h>
+#include <QskScrollArea.h>
+
+TabView::TabView( QQuickItem* parent )
+    : QskTabView( parent )
+{
+    setAutoFitTabs( true );
+}
+
+void TabView::setPagesEnabled( bool on )
+{
+    for ( int i = 0; i < count(); i++ )
+        pageAt( i )->setEnabled( on );
+}
+
+void TabView::addPage( const QString& tabText, QQuickItem* page )
+{
+    auto scrollArea = new QskScrollArea();
+    scrollArea->setMargins( 5 );
+
+#if 1
+    /*
+        We need a mode, where the focus policy gets adjusted
+        when a scroll bar becomes visible. TODO ...
+     */
+    scrollArea->setFocusPolicy( Qt::NoFocus );
+#endif
+
+    // hiding the viewport
+    scrollArea->setGradientHint( QskScrollView::Viewport, QskGradient() );
+    scrollArea->setBoxShapeHint( QskScrollView::Viewport, 0 );
+    scrollArea->setBoxBorderMetricsHint( QskScrollView::Viewport, 0 );
+
+    scrollArea->setItemResizable( true );
+    scrollArea->setScrolledItem( page );
+
+    addTab( tabText, scrollArea );
+}
+
+QskScrollArea* TabView::currentScrollArea() const
+{
+    return static_cast< QskScrollArea* >( pageAt( currentIndex() ) );
+}
@@ -0,0 +1,21 @@
+/******************************************************************************
+ * QSkinny - Copyright (C) The authors
+ *           SPDX-License-Identifier: BSD-3-Clause
+ *****************************************************************************/
+
+#pragma once
+
+#include <QskTabView.h>
+
+class QskScrollArea;
+
+class TabView : public QskTabView
+{
+  public:
+    TabView( QQuickItem* parent = nullptr );
+
+    void setPagesEnabled( bool );
+
+    void addPage( const QString& tabText, QQuickItem* page );
+    QskScrollArea* currentScrollArea() const;
+};
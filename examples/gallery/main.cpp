@@ -11,6 +11,9 @@
 #include "dialog/DialogPage.h"
 #include "listbox/ListBoxPage.h"
 
+#include "GraphicProvider.h"
+#include "TabView.h"
+
 #include <SkinnyShortcut.h>
 #include <SkinnyShapeProvider.h>
 #include <SkinnyNamespace.h>
@@ -20,11 +23,9 @@
 #include <QskFocusIndicator.h>
 #include <QskObjectCounter.h>
 #include <QskDrawer.h>
-#include <QskTabView.h>
 #include <QskTextLabel.h>
 #include <QskSwitchButton.h>
 #include <QskPushButton.h>
-#include <QskScrollArea.h>
 #include <QskMenu.h>
 #include <QskWindow.h>
 #include <QskDialog.h>
@@ -34,28 +35,12 @@
 #include <QskAnimationHint.h>
 #include <QskBoxBorderMetrics.h>
 #include <QskBoxShapeMetrics.h>
-#include <QskGraphicProvider.h>
-#include <QskGraphicIO.h>
-#include <QskGraphic.h>
 #include <QskSetup.h>
 
 #include <QGuiApplication>
 
 namespace
 {
-    class GraphicProvider : public QskGraphicProvider
-    {
-      protected:
-        const QskGraphic* loadGraphic( const QString& id ) const override
-        {
-            const QString path = QStringLiteral( ":gallery/icons/qvg/" )
-                + id + QStringLiteral( ".qvg" );
-
-            const auto graphic = QskGraphicIO::read( path );
-            return graphic.isNull() ? nullptr : new QskGraphic( graphic );
-        }
-    };
-
     class Drawer : public QskDrawer
     {
       public:
@@ -79,46 +64,6 @@ namespace
         }
     };
 
-    class TabView : public QskTabView
-    {
-      public:
-        TabView( QQuickItem* parent = nullptr )
-            : QskTabView( parent )
-        {
-            setAutoFitTabs( true );
-        }
-
-        void setPagesEnabled( bool on )
-        {
-            for ( int i = 0; i < count(); i++ )
-                pageAt( i )->setEnabled( on );
-        }
-
-        void addPage( const QString& tabText, QQuickItem* page )
-        {
-            auto scrollArea = new QskScrollArea();
-            scrollArea->setMargins( 5 );
-
-#if 1
-            /*
-                We need a mode, where the focus policy gets adjusted
-                when a scroll bar becomes visible. TODO ...
-             */
-            scrollArea->setFocusPolicy( Qt::NoFocus );
-#endif
-
-            // hiding the viewport
-            scrollArea->setGradientHint( QskScrollView::Viewport, QskGradient() );
-            scrollArea->setBoxShapeHint( QskScrollView::Viewport, 0 );
-            scrollArea->setBoxBorderMetricsHint( QskScrollView::Viewport, 0 );
-
-            scrollArea->setItemResizable( true );
-            scrollArea->setScrolledItem( page );
-
-            addTab( tabText, scrollArea );
-        }
-    };
-
     class MenuButton : public QskPushButton
     {
       public:
@@ -0,0 +1,17 @@
+############################################################################
+# QSkinny - Copyright (C) The authors
+#           SPDX-License-Identifier: BSD-3-Clause
+############################################################################
+
+# shared with benchmarks/layouts
+set(LAYOUTS_SOURCES
+    TestRectangle.h TestRectangle.cpp
+    ButtonBox.h ButtonBox.cpp
+    FlowLayoutPage.h FlowLayoutPage.cpp
+    GridLayoutPage.h GridLayoutPage.cpp
+    LinearLayoutPage.h LinearLayoutPage.cpp
+    DynamicConstraintsPage.h DynamicConstraintsPage.cpp
+    StackLayoutPage.h StackLayoutPage.cpp
+    SwipeViewPage.h SwipeViewPage.cpp
+)
+list(TRANSFORM LAYOUTS_SOURCES PREPEND ${CMAKE_CURRENT_LIST_DIR}/)
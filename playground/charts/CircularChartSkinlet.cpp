@@ -12,6 +12,7 @@
 #include <QskArcNode.h>
 
 #include <qpainterpath.h>
+#include <qquickwindow.h>
 #include <qmath.h>
 
 #define PAINTED_NODE 0
@@ -349,8 +350,6 @@ QSGNode* CircularChartSkinlet::updateArcSegmentNode(
     arcNode->setArcData( m_data->closedArcRect, metrics,
         borderWidth, borderColor, gradient, chart->window() );
 #else
-    Q_UNUSED( skinnable )
-
     auto fillGradient = gradient;
 
     if ( fillGradient.type() == QskGradient::Stops )
@@ -364,6 +363,9 @@ QSGNode* CircularChartSkinlet::updateArcSegmentNode(
     if ( arcNode == nullptr )
         arcNode = new QskArcNode();
 
+    if ( auto window = skinnable->owningItem()->window() )
+        arcNode->setDevicePixelRatio( window->effectiveDevicePixelRatio() );
+
     arcNode->setArcData( m_data->closedArcRect, metrics,
         borderWidth, borderColor, fillGradient );
 #endif
@@ -0,0 +1,197 @@
+/******************************************************************************
+ * QSkinny - Copyright (C) The authors
+ *           SPDX-License-Identifier: BSD-3-Clause
+ *****************************************************************************/
+
+#include "Throughput.h"
+
+#include <QskCoalescingInvoker.h>
+#include <QskMetaInvokable.h>
+
+#include <QCoreApplication>
+#include <QDebug>
+#include <QElapsedTimer>
+#include <QMetaProperty>
+#include <QThread>
+#include <QVector>
+
+#include <memory>
+#include <utility>
+#include <vector>
+
+namespace
+{
+    class Receiver : public QObject
+    {
+        Q_OBJECT
+
+        Q_PROPERTY( int value READ value WRITE setValue )
+
+      public:
+        int value() const { return m_value; }
+
+        void setValue( int value )
+        {
+            m_value = value;
+            m_writeCount++;
+        }
+
+        int writeCount() const { return m_writeCount; }
+
+      private:
+        int m_value = -1;
+        int m_writeCount = 0;
+    };
+
+    class Receivers : public std::vector< std::unique_ptr< Receiver > >
+    {
+      public:
+        Receivers( int count )
+        {
+            for ( int i = 0; i < count; i++ )
+                emplace_back( new Receiver() );
+        }
+
+        int writeCount() const
+        {
+            int count = 0;
+            for ( const auto& receiver : *this )
+                count += receiver->writeCount();
+
+            return count;
+        }
+    };
+}
+
+template< typename Post >
+static qint64 qskRunThreads( int threadCount, int postCount, Post post )
+{
+    QElapsedTimer timer;
+    timer.start();
+
+    QVector< QThread* > threads;
+
+    for ( int i = 0; i < threadCount; i++ )
+    {
+        auto thread = QThread::create(
+            [ = ]() mutable
+            {
+                for ( int j = 0; j < postCount; j++ )
+                    post( i, j );
+            } );
+
+        threads += thread;
+        thread->start();
+    }
+
+    // the GUI thread keeps delivering, while the workers are posting
+
+    bool isRunning = true;
+    while ( isRunning )
+    {
+        QCoreApplication::processEvents();
+
+        isRunning = false;
+        for ( auto thread : std::as_const( threads ) )
+            isRunning = isRunning || thread->isRunning();
+    }
+
+    for ( auto thread : std::as_const( threads ) )
+    {
+        thread->wait();
+        delete thread;
+    }
+
+    QCoreApplication::sendPostedEvents();
+
+    return timer.elapsed();
+}
+
+static void qskReport( const char* title, int postCount,
+    int deliveryCount, int coalescedCount, int droppedCount, qint64 ms )
+{
+    const auto rate = ( ms > 0 ) ? ( 1000.0 * postCount / ms ) : 0.0;
+
+    qDebug().nospace() << "== " << title
+        << ": posts: " << postCount
+        << ", delivered: " << deliveryCount
+        << ", coalesced: " << coalescedCount
+        << ", dropped: " << droppedCount
+        << ", elapsed: " << ms << "ms"
+        << ", posts/s: " << qRound64( rate );
+}
+
+Throughput::Throughput( int threadCount, int postCount, int channelCount )
+    : m_threadCount( qMax( threadCount, 1 ) )
+    , m_postCount( qMax( postCount, 1 ) )
+    , m_channelCount( qMax( channelCount, 1 ) )
+{
+}
+
+void Throughput::run()
+{
+    qDebug() << "== Throughput:" << m_threadCount << "threads,"
+        << m_postCount << "posts per thread," << m_channelCount << "receivers";
+
+    runQueued();
+    runCoalescing();
+}
+
+void Throughput::runQueued()
+{
+    Receivers receivers( m_channelCount );
+
+    // copied into each thread
+    QskMetaInvokable invokable( Receiver::staticMetaObject.property(
+        Receiver::staticMetaObject.indexOfProperty( "value" ) ) );
+
+    const auto channelCount = m_channelCount;
+    auto receiverList = &receivers;
+
+    const auto ms = qskRunThreads( m_threadCount, m_postCount,
+        [ = ]( int, int value ) mutable
+        {
+            void* args[] = { nullptr, &value };
+            invokable.invoke( ( *receiverList )[ value % channelCount ].get(),
+                args, Qt::QueuedConnection );
+        } );
+
+    const int postCount = m_threadCount * m_postCount;
+    const int deliveryCount = receivers.writeCount();
+
+    qskReport( "Queued", postCount, deliveryCount,
+        0, postCount - deliveryCount, ms );
+}
+
+void Throughput::runCoalescing()
+{
+    Receivers receivers( m_channelCount );
+
+    QskCoalescingInvoker invoker;
+
+    QVector< QskCoalescingInvoker::Channel* > channels;
+    for ( const auto& receiver : receivers )
+        channels += invoker.addChannel( receiver.get(), "value" );
+
+    auto invokerPtr = &invoker;
+
+    const auto ms = qskRunThreads( m_threadCount, m_postCount,
+        [ = ]( int, int value )
+        {
+            invokerPtr->post( channels[ value % channels.count() ], value );
+        } );
+
+    invoker.flush();
+
+    const auto statistics = invoker.statistics();
+
+    qskReport( "Coalescing",
+        static_cast< int >( statistics.postCount ),
+        receivers.writeCount(),
+        static_cast< int >( statistics.coalescedCount ),
+        static_cast< int >( statistics.droppedCount ), ms );
+
+    qDebug() << "   flushes:" << statistics.flushCount;
+}
+
+#include "Throughput.moc"
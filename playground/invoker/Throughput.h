@@ -0,0 +1,29 @@
+/******************************************************************************
+ * QSkinny - Copyright (C) The authors
+ *           SPDX-License-Identifier: BSD-3-Clause
+ *****************************************************************************/
+
+#pragma once
+
+/*
+    Worker threads posting values to receivers in the GUI thread:
+
+    - a queued QskMetaInvokable call for each value
+    - QskCoalescingInvoker, where only the latest value of a receiver
+      is delivered
+ */
+class Throughput
+{
+  public:
+    Throughput( int threadCount, int postCount, int channelCount );
+
+    void run();
+
+  private:
+    void runQueued();
+    void runCoalescing();
+
+    const int m_threadCount;
+    const int m_postCount;
+    const int m_channelCount;
+};
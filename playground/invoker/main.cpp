@@ -4,6 +4,7 @@
  *****************************************************************************/
 
 #include "Invoker.h"
+#include "Throughput.h"
 
 #include <QCoreApplication>
 #include <QDebug>
@@ -184,6 +185,14 @@ int main( int argc, char* argv[] )
 {
     Application app( argc, argv );
 
+    if ( app.arguments().contains( QStringLiteral( "--benchmark" ) ) )
+    {
+        Throughput throughput( 4, 250000, 16 );
+        throughput.run();
+
+        return 0;
+    }
+
     app.invokeDirect();
 
     QTimer::singleShot( 0, &app, &Application::invokeQueued );
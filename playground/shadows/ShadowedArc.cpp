@@ -13,6 +13,8 @@
 #include <QskArcNode.h>
 #include <QskSGNode.h>
 
+#include <qquickwindow.h>
+
 QSK_SUBCONTROL( ShadowedArc, Arc )
 
 namespace
@@ -73,6 +75,9 @@ namespace
 
         auto arcNode = QskSGNode::ensureNode< QskArcNode >( node );
 
+        if ( auto window = arc->window() )
+            arcNode->setDevicePixelRatio( window->effectiveDevicePixelRatio() );
+
         const auto metrics = arc->arcMetricsHint( Q::Arc );
         const auto fillGradient = arc->gradientHint( Q::Arc );
 
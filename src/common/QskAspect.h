@@ -206,6 +206,7 @@ class QSK_EXPORT QskAspect
     static Subcontrol nextSubcontrol( const QMetaObject*, const char* );
 
     static QByteArray subControlName( Subcontrol );
+    static const QMetaObject* subControlMetaObject( Subcontrol );
     static QVector< QByteArray > subControlNames( const QMetaObject* = nullptr );
     static QVector< Subcontrol > subControls( const QMetaObject* );
 
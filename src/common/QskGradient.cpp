@@ -84,7 +84,7 @@ QskGradient::QskGradient( QGradient::Preset preset )
     setStops( qskBuildGradientStops( QGradient( preset ).stops() ) );
 }
 
-QskGradient::QskGradient( const QVector< QskGradientStop >& stops )
+QskGradient::QskGradient( const QskGradientStops& stops )
     : QskGradient()
 {
     setStops( stops );
@@ -350,13 +350,16 @@ qreal QskGradient::stopAt( int index ) const noexcept
 
 bool QskGradient::hasStopAt( qreal value ) const noexcept
 {
+    // the stops store their positions as float
+    const qreal pos = static_cast< float >( value );
+
     // better use binary search TODO ...
     for ( auto& stop : m_stops )
     {
-        if ( stop.position() == value )
+        if ( stop.position() == pos )
             return true;
 
-        if ( stop.position() > value )
+        if ( stop.position() > pos )
             break;
     }
 
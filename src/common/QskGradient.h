@@ -232,8 +232,8 @@ inline const QskGradientStops& QskGradient::stops() const noexcept
         Returning a const& so that it is possible to write:
             for ( const auto& stop : gradient.stops() )
 
-        Once we have changed QskGradientStop from QColor to QRgb
-        we should check if there is a better solution possible
+        As the stops are stored inline this does not allocate
+        for the most common gradients anyway.
      */
 #endif
     return m_stops;
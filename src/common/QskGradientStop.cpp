@@ -15,45 +15,64 @@
 static void qskRegisterGradientStop()
 {
     qRegisterMetaType< QskGradientStop >();
+    qRegisterMetaType< QskGradientStops >();
 
 #if QT_VERSION < QT_VERSION_CHECK( 6, 0, 0 )
     QMetaType::registerEqualsComparator< QskGradientStop >();
+    QMetaType::registerEqualsComparator< QskGradientStops >();
 #endif
+
+    // for being able to use the stops as sequence in QML
+    QMetaType::registerConverter< QskGradientStops, QVector< QskGradientStop > >(
+        []( const QskGradientStops& stops ) { return stops.toVector(); } );
+
+    QMetaType::registerConverter< QVector< QskGradientStop >, QskGradientStops >(
+        []( const QVector< QskGradientStop >& stops ) { return QskGradientStops( stops ); } );
 }
 
 Q_CONSTRUCTOR_FUNCTION( qskRegisterGradientStop )
 
 void QskGradientStop::setPosition( qreal position ) noexcept
 {
-    m_position = position;
+    m_position = static_cast< float >( position );
 }
 
 void QskGradientStop::setColor( const QColor& color ) noexcept
 {
-    m_color = color;
+    m_rgb = color.rgba();
+    m_valid = color.isValid();
 }
 
 void QskGradientStop::setRgb( QRgb rgb ) noexcept
 {
-    m_color = QColor::fromRgba( rgb );
+    m_rgb = rgb;
+    m_valid = true;
 }
 
 void QskGradientStop::setStop( qreal position, const QColor& color ) noexcept
 {
-    m_position = position;
-    m_color = color;
+    setPosition( position );
+    setColor( color );
 }
 
 void QskGradientStop::setStop( qreal position, Qt::GlobalColor color ) noexcept
 {
-    m_position = position;
-    m_color = color;
+    setPosition( position );
+    setColor( color );
+}
+
+void QskGradientStop::setStop( qreal position, QRgb rgb ) noexcept
+{
+    setPosition( position );
+    setRgb( rgb );
 }
 
 QskHashValue QskGradientStop::hash( QskHashValue seed ) const noexcept
 {
-    auto hash = qHashBits( &m_position, sizeof( m_position ), seed );
-    return qHashBits( &m_color, sizeof( m_color ), hash );
+    auto hash = qHash( m_position, seed );
+    hash = qHash( m_rgb, hash );
+
+    return qHash( m_valid, hash );
 }
 
 QColor QskGradientStop::interpolated(
@@ -78,6 +97,137 @@ QColor QskGradientStop::interpolated(
     return QskRgb::interpolated( min->color(), max->color(), r );
 }
 
+QskGradientStops::QskGradientStops( std::initializer_list< QskGradientStop > stops )
+{
+    reserve( static_cast< int >( stops.size() ) );
+
+    for ( const auto& stop : stops )
+        append( stop );
+}
+
+QskGradientStops::QskGradientStops( const QVector< QskGradientStop >& stops )
+{
+    reserve( static_cast< int >( stops.size() ) );
+
+    for ( const auto& stop : stops )
+        append( stop );
+}
+
+QskGradientStops::QskGradientStops( const QskGradientStops& other )
+{
+    reserve( other.m_count );
+
+    std::copy( other.begin(), other.end(), data() );
+    m_count = other.m_count;
+}
+
+QskGradientStops::QskGradientStops( QskGradientStops&& other ) noexcept
+{
+    *this = std::move( other );
+}
+
+QskGradientStops::~QskGradientStops()
+{
+    delete[] m_heap;
+}
+
+QskGradientStops& QskGradientStops::operator=( const QskGradientStops& other )
+{
+    if ( this != &other )
+    {
+        m_count = 0;
+        reserve( other.m_count );
+
+        std::copy( other.begin(), other.end(), data() );
+        m_count = other.m_count;
+    }
+
+    return *this;
+}
+
+QskGradientStops& QskGradientStops::operator=( QskGradientStops&& other ) noexcept
+{
+    if ( this == &other )
+        return *this;
+
+    if ( other.m_heap )
+    {
+        delete[] m_heap;
+
+        m_heap = other.m_heap;
+        m_capacity = other.m_capacity;
+
+        other.m_heap = nullptr;
+        other.m_capacity = InlineCapacity;
+    }
+    else
+    {
+        /*
+            As the capacity of a heap buffer is always above
+            InlineCapacity it can be reused for the inline stops
+         */
+        std::copy( other.m_inline, other.m_inline + other.m_count, data() );
+    }
+
+    m_count = other.m_count;
+    other.m_count = 0;
+
+    return *this;
+}
+
+bool QskGradientStops::operator==( const QskGradientStops& other ) const noexcept
+{
+    return ( m_count == other.m_count )
+        && std::equal( begin(), end(), other.begin() );
+}
+
+void QskGradientStops::reserve( int capacity )
+{
+    if ( capacity > m_capacity )
+        reallocate( qMax( capacity, 2 * m_capacity ) );
+}
+
+void QskGradientStops::reallocate( int capacity )
+{
+    auto stops = new QskGradientStop[ capacity ];
+    std::copy( begin(), end(), stops );
+
+    delete[] m_heap;
+
+    m_heap = stops;
+    m_capacity = capacity;
+}
+
+void QskGradientStops::clear() noexcept
+{
+    /*
+        Keeping a heap buffer, as the stops are usually
+        cleared for being refilled.
+     */
+    m_count = 0;
+}
+
+QVector< QskGradientStop > QskGradientStops::toVector() const
+{
+    QVector< QskGradientStop > stops;
+    stops.reserve( m_count );
+
+    for ( const auto& stop : *this )
+        stops += stop;
+
+    return stops;
+}
+
+QskHashValue QskGradientStops::hash( QskHashValue seed ) const noexcept
+{
+    auto hash = qHash( m_count, seed );
+
+    for ( const auto& stop : *this )
+        hash = stop.hash( hash );
+
+    return hash;
+}
+
 #ifndef QT_NO_DEBUG_STREAM
 
 #include <qdebug.h>
@@ -93,6 +243,26 @@ QDebug operator<<( QDebug debug, const QskGradientStop& stop )
     return debug;
 }
 
+QDebug operator<<( QDebug debug, const QskGradientStops& stops )
+{
+    QDebugStateSaver saver( debug );
+    debug.nospace();
+
+    debug << "QskGradientStops(";
+
+    for ( int i = 0; i < stops.count(); i++ )
+    {
+        if ( i > 0 )
+            debug << ", ";
+
+        debug << stops[i];
+    }
+
+    debug << ")";
+
+    return debug;
+}
+
 #endif
 
 #include "moc_QskGradientStop.cpp"
@@ -179,7 +349,8 @@ static QskGradientStops qskInterpolatedStops(
         stop at a specific position of the other stops we
         have to calculate one temporarily before interpolating.
      */
-    QVector< QskGradientStop > stops;
+    QskGradientStops stops;
+    stops.reserve( from.count() + to.count() );
 
     int i = 0, j = 0;
     while ( ( i < from.count() ) || ( j < to.count() ) )
@@ -304,8 +475,8 @@ QskGradientStops qskExtractedGradientStops(
     from = qMax( from, 0.0 );
     to = qMin( to, 1.0 );
 
-    QVector< QskGradientStop > extracted;
-    extracted.reserve( stops.count() );
+    QskGradientStops extracted;
+    extracted.reserve( stops.count() + 2 );
 
     int i = 0;
 
@@ -335,7 +506,7 @@ QskGradientStops qskExtractedGradientStops(
 
 QskGradientStops qskRevertedGradientStops( const QskGradientStops& stops )
 {
-    QVector< QskGradientStop > s;
+    QskGradientStops s;
     s.reserve( stops.count() );
 
     for ( auto it = stops.crbegin(); it != stops.crend(); ++it )
@@ -344,9 +515,9 @@ QskGradientStops qskRevertedGradientStops( const QskGradientStops& stops )
     return s;
 }
 
-QVector< QskGradientStop > qskBuildGradientStops( const QGradientStops& qtStops )
+QskGradientStops qskBuildGradientStops( const QGradientStops& qtStops )
 {
-    QVector< QskGradientStop > stops;
+    QskGradientStops stops;
     stops.reserve( qtStops.count() );
 
     for ( const auto& s : qtStops )
@@ -356,10 +527,10 @@ QVector< QskGradientStop > qskBuildGradientStops( const QGradientStops& qtStops
 }
 
 template< typename T >
-static inline QVector< QskGradientStop > qskCreateStops(
+static inline QskGradientStops qskCreateStops(
     const QVector< T > colors, bool discrete )
 {
-    QVector< QskGradientStop > stops;
+    QskGradientStops stops;
 
     const auto count = colors.count();
     if ( count == 0 )
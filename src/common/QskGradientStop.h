@@ -12,6 +12,9 @@
 #include <qmetatype.h>
 #include <qvector.h>
 
+#include <initializer_list>
+#include <iterator>
+
 typedef QPair< qreal, QColor > QGradientStop;
 
 class QSK_EXPORT QskGradientStop
@@ -23,8 +26,8 @@ class QSK_EXPORT QskGradientStop
 
   public:
     constexpr QskGradientStop() noexcept = default;
-    constexpr QskGradientStop( qreal position, const QColor& ) noexcept;
-    constexpr QskGradientStop( const QGradientStop& ) noexcept;
+    QskGradientStop( qreal position, const QColor& ) noexcept;
+    QskGradientStop( const QGradientStop& ) noexcept;
 
     QskGradientStop( qreal position, Qt::GlobalColor ) noexcept;
     QskGradientStop( qreal position, QRgb ) noexcept;
@@ -39,11 +42,11 @@ class QSK_EXPORT QskGradientStop
     constexpr qreal position() const noexcept;
     void setPosition( qreal position ) noexcept;
 
-    constexpr const QColor& color() const noexcept;
+    QColor color() const noexcept;
     void setColor( const QColor& ) noexcept;
 
     void setRgb( QRgb ) noexcept;
-    QRgb rgb() const noexcept;
+    constexpr QRgb rgb() const noexcept;
 
     static QColor interpolated(
         const QskGradientStop&, const QskGradientStop&, qreal position ) noexcept;
@@ -51,8 +54,17 @@ class QSK_EXPORT QskGradientStop
     QskHashValue hash( QskHashValue seed ) const noexcept;
 
   private:
-    qreal m_position = -1.0;
-    QColor m_color; // using QRgb instead ?
+    /*
+        Gradients are stored by value in many places, so a stop
+        is packed into 12 bytes. Positions are fine with float
+        precision and the colors are converted to QRgb anyway,
+        when being passed to the scene graph.
+     */
+    float m_position = -1.0f;
+    QRgb m_rgb = 0;
+
+    // an invalid QColor is what makes a gradient invalid
+    bool m_valid = false;
 };
 
 #if QT_VERSION >= QT_VERSION_CHECK( 6, 0, 0 )
@@ -61,10 +73,11 @@ class QSK_EXPORT QskGradientStop
 
 Q_DECLARE_METATYPE( QskGradientStop )
 
-inline constexpr QskGradientStop::QskGradientStop(
+inline QskGradientStop::QskGradientStop(
         qreal position, const QColor& color ) noexcept
-    : m_position( position )
-    , m_color( color )
+    : m_position( static_cast< float >( position ) )
+    , m_rgb( color.rgba() )
+    , m_valid( color.isValid() )
 {
 }
 
@@ -76,11 +89,13 @@ inline QskGradientStop::QskGradientStop(
 
 inline QskGradientStop::QskGradientStop(
         qreal position, QRgb rgb ) noexcept
-    : QskGradientStop( position, QColor::fromRgba( rgb ) )
+    : m_position( static_cast< float >( position ) )
+    , m_rgb( rgb )
+    , m_valid( true )
 {
 }
 
-inline constexpr QskGradientStop::QskGradientStop( const QGradientStop& qtStop ) noexcept
+inline QskGradientStop::QskGradientStop( const QGradientStop& qtStop ) noexcept
     : QskGradientStop( qtStop.first, qtStop.second )
 {
 }
@@ -90,19 +105,20 @@ inline constexpr qreal QskGradientStop::position() const noexcept
     return m_position;
 }
 
-inline constexpr const QColor& QskGradientStop::color() const noexcept
+inline QColor QskGradientStop::color() const noexcept
 {
-    return m_color;
+    return m_valid ? QColor::fromRgba( m_rgb ) : QColor();
 }
 
-inline QRgb QskGradientStop::rgb() const noexcept
+inline constexpr QRgb QskGradientStop::rgb() const noexcept
 {
-    return m_color.rgba();
+    return m_rgb;
 }
 
 inline constexpr bool QskGradientStop::operator==( const QskGradientStop& other ) const noexcept
 {
-    return ( m_position == other.m_position ) && ( m_color == other.m_color );
+    return ( m_position == other.m_position )
+        && ( m_rgb == other.m_rgb ) && ( m_valid == other.m_valid );
 }
 
 inline constexpr bool QskGradientStop::operator!=( const QskGradientStop& other ) const noexcept
@@ -118,7 +134,271 @@ QSK_EXPORT QDebug operator<<( QDebug, const QskGradientStop& );
 
 #endif
 
-typedef QVector< QskGradientStop > QskGradientStops;
+/*
+    Most gradients have 1 or 2 stops, and only a few more than 4.
+    QskGradientStops stores up to 4 stops inline, so that creating,
+    copying or comparing gradients does not allocate. For more stops
+    the container falls back to the heap.
+
+    With 12 bytes per stop the container has a size of 64 bytes,
+    compared to the 24 bytes of a QVector, that needs an allocation
+    for its first stop.
+
+    The API is the subset of QVector, that is needed for gradients.
+ */
+class QSK_EXPORT QskGradientStops
+{
+  public:
+    using value_type = QskGradientStop;
+
+    using iterator = QskGradientStop*;
+    using const_iterator = const QskGradientStop*;
+
+    using reverse_iterator = std::reverse_iterator< iterator >;
+    using const_reverse_iterator = std::reverse_iterator< const_iterator >;
+
+    QskGradientStops() noexcept = default;
+    QskGradientStops( std::initializer_list< QskGradientStop > );
+    QskGradientStops( const QVector< QskGradientStop >& );
+
+    QskGradientStops( const QskGradientStops& );
+    QskGradientStops( QskGradientStops&& ) noexcept;
+
+    ~QskGradientStops();
+
+    QskGradientStops& operator=( const QskGradientStops& );
+    QskGradientStops& operator=( QskGradientStops&& ) noexcept;
+
+    bool operator==( const QskGradientStops& ) const noexcept;
+    bool operator!=( const QskGradientStops& ) const noexcept;
+
+    int count() const noexcept;
+    int size() const noexcept;
+    bool isEmpty() const noexcept;
+
+    int capacity() const noexcept;
+    void reserve( int );
+
+    void clear() noexcept;
+
+    void append( const QskGradientStop& );
+    QskGradientStops& operator+=( const QskGradientStop& );
+    QskGradientStops& operator<<( const QskGradientStop& );
+
+    const QskGradientStop& at( int ) const noexcept;
+
+    const QskGradientStop& operator[]( int ) const noexcept;
+    QskGradientStop& operator[]( int ) noexcept;
+
+    const QskGradientStop& first() const noexcept;
+    QskGradientStop& first() noexcept;
+
+    const QskGradientStop& last() const noexcept;
+    QskGradientStop& last() noexcept;
+
+    const QskGradientStop* constData() const noexcept;
+    const QskGradientStop* data() const noexcept;
+    QskGradientStop* data() noexcept;
+
+    iterator begin() noexcept;
+    iterator end() noexcept;
+
+    const_iterator begin() const noexcept;
+    const_iterator end() const noexcept;
+
+    const_iterator cbegin() const noexcept;
+    const_iterator cend() const noexcept;
+
+    const_iterator constBegin() const noexcept;
+    const_iterator constEnd() const noexcept;
+
+    reverse_iterator rbegin() noexcept;
+    reverse_iterator rend() noexcept;
+
+    const_reverse_iterator crbegin() const noexcept;
+    const_reverse_iterator crend() const noexcept;
+
+    QVector< QskGradientStop > toVector() const;
+
+    QskHashValue hash( QskHashValue seed = 0 ) const noexcept;
+
+  private:
+    void reallocate( int capacity );
+
+    enum { InlineCapacity = 4 };
+
+    int m_count = 0;
+    int m_capacity = InlineCapacity;
+
+    QskGradientStop* m_heap = nullptr;
+    QskGradientStop m_inline[ InlineCapacity ];
+};
+
+Q_DECLARE_METATYPE( QskGradientStops )
+
+inline bool QskGradientStops::operator!=( const QskGradientStops& other ) const noexcept
+{
+    return !( *this == other );
+}
+
+inline int QskGradientStops::count() const noexcept
+{
+    return m_count;
+}
+
+inline int QskGradientStops::size() const noexcept
+{
+    return m_count;
+}
+
+inline bool QskGradientStops::isEmpty() const noexcept
+{
+    return m_count == 0;
+}
+
+inline int QskGradientStops::capacity() const noexcept
+{
+    return m_capacity;
+}
+
+inline void QskGradientStops::append( const QskGradientStop& stop )
+{
+    if ( m_count == m_capacity )
+        reallocate( 2 * m_capacity );
+
+    data()[ m_count++ ] = stop;
+}
+
+inline QskGradientStops& QskGradientStops::operator+=( const QskGradientStop& stop )
+{
+    append( stop );
+    return *this;
+}
+
+inline QskGradientStops& QskGradientStops::operator<<( const QskGradientStop& stop )
+{
+    append( stop );
+    return *this;
+}
+
+inline const QskGradientStop& QskGradientStops::at( int index ) const noexcept
+{
+    Q_ASSERT( index >= 0 && index < m_count );
+    return constData()[ index ];
+}
+
+inline const QskGradientStop& QskGradientStops::operator[]( int index ) const noexcept
+{
+    Q_ASSERT( index >= 0 && index < m_count );
+    return constData()[ index ];
+}
+
+inline QskGradientStop& QskGradientStops::operator[]( int index ) noexcept
+{
+    Q_ASSERT( index >= 0 && index < m_count );
+    return data()[ index ];
+}
+
+inline const QskGradientStop& QskGradientStops::first() const noexcept
+{
+    return at( 0 );
+}
+
+inline QskGradientStop& QskGradientStops::first() noexcept
+{
+    return operator[]( 0 );
+}
+
+inline const QskGradientStop& QskGradientStops::last() const noexcept
+{
+    return at( m_count - 1 );
+}
+
+inline QskGradientStop& QskGradientStops::last() noexcept
+{
+    return operator[]( m_count - 1 );
+}
+
+inline const QskGradientStop* QskGradientStops::constData() const noexcept
+{
+    return m_heap ? m_heap : m_inline;
+}
+
+inline const QskGradientStop* QskGradientStops::data() const noexcept
+{
+    return constData();
+}
+
+inline QskGradientStop* QskGradientStops::data() noexcept
+{
+    return m_heap ? m_heap : m_inline;
+}
+
+inline QskGradientStops::iterator QskGradientStops::begin() noexcept
+{
+    return data();
+}
+
+inline QskGradientStops::iterator QskGradientStops::end() noexcept
+{
+    return data() + m_count;
+}
+
+inline QskGradientStops::const_iterator QskGradientStops::begin() const noexcept
+{
+    return constData();
+}
+
+inline QskGradientStops::const_iterator QskGradientStops::end() const noexcept
+{
+    return constData() + m_count;
+}
+
+inline QskGradientStops::const_iterator QskGradientStops::cbegin() const noexcept
+{
+    return begin();
+}
+
+inline QskGradientStops::const_iterator QskGradientStops::cend() const noexcept
+{
+    return end();
+}
+
+inline QskGradientStops::const_iterator QskGradientStops::constBegin() const noexcept
+{
+    return begin();
+}
+
+inline QskGradientStops::const_iterator QskGradientStops::constEnd() const noexcept
+{
+    return end();
+}
+
+inline QskGradientStops::reverse_iterator QskGradientStops::rbegin() noexcept
+{
+    return reverse_iterator( end() );
+}
+
+inline QskGradientStops::reverse_iterator QskGradientStops::rend() noexcept
+{
+    return reverse_iterator( begin() );
+}
+
+inline QskGradientStops::const_reverse_iterator QskGradientStops::crbegin() const noexcept
+{
+    return const_reverse_iterator( end() );
+}
+
+inline QskGradientStops::const_reverse_iterator QskGradientStops::crend() const noexcept
+{
+    return const_reverse_iterator( begin() );
+}
+
+#ifndef QT_NO_DEBUG_STREAM
+
+QSK_EXPORT QDebug operator<<( QDebug, const QskGradientStops& );
+
+#endif
 
 QSK_EXPORT QColor qskInterpolatedColorAt( const QskGradientStops&, qreal pos ) noexcept;
 
@@ -150,6 +430,6 @@ QSK_EXPORT QskGradientStops qskBuildGradientStops(
 QSK_EXPORT QskGradientStops qskRevertedGradientStops( const QskGradientStops& );
 
 QSK_EXPORT QskGradientStops qskBuildGradientStops( const QVector< QGradientStop >& );
-QSK_EXPORT QVector< QGradientStop > qskToQGradientStops( const QVector< QskGradientStop >& );
+QSK_EXPORT QVector< QGradientStop > qskToQGradientStops( const QskGradientStops& );
 
 #endif
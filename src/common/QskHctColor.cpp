@@ -679,17 +679,48 @@ static double inverseChromaticAdaptation( double adapted )
     return signum(adapted) * pow( base, 1.0 / 0.42 );
 }
 
-static QRgb findResultByJ( double hueRadians, double chroma, double y )
+namespace
+{
+    /*
+        The terms of findResultByJ, that depend on the hue only. When
+        converting a tonal palette they are the same for all tones.
+     */
+    class HueTerms
+    {
+      public:
+        HueTerms( double hue )
+            : hue( hue )
+            , radians( hue / 180.0 * M_PI )
+            , hSin( sin( radians ) )
+            , hCos( cos( radians ) )
+        {
+            constexpr ViewingConditions vc;
+
+            const double eHue = 0.25 * ( cos( radians + 2.0 ) + 3.8 );
+            p1 = eHue * ( 50000.0 / 13.0 ) * vc.nbb;
+        }
+
+        double hue; // sanitized degrees
+        double radians;
+        double hSin;
+        double hCos;
+
+        double p1;
+    };
+}
+
+static QRgb findResultByJ( const HueTerms& terms, double chroma, double y )
 {
     double j = sqrt(y) * 11.0;
 
     constexpr ViewingConditions vc;
 
-    const double tInnerCoeff = 1.0 / pow( 1.64 - pow( 0.29, vc.backgroundYTowhitePointY ), 0.73 );
-    const double eHue = 0.25 * ( cos( hueRadians + 2.0 ) + 3.8 );
-    const double p1 = eHue * ( 50000.0 / 13.0 ) * vc.nbb;
-    const double hSin = sin(hueRadians);
-    const double hCos = cos(hueRadians);
+    static const double tInnerCoeff =
+        1.0 / pow( 1.64 - pow( 0.29, vc.backgroundYTowhitePointY ), 0.73 );
+
+    const double p1 = terms.p1;
+    const double hSin = terms.hSin;
+    const double hCos = terms.hCos;
 
     for ( int i = 0; i < 5; i++ )
     {
@@ -747,24 +778,34 @@ static QRgb findResultByJ( double hueRadians, double chroma, double y )
     return 0;
 }
 
-static inline QRgb getRgb( double hue, double chroma, double tone )
+static inline bool isAchromatic( double chroma, double tone )
 {
-    if ( chroma < 0.0001 || tone < 0.0001 || tone > 99.9999 )
-        return argbFromLstar( tone );
+    return chroma < 0.0001 || tone < 0.0001 || tone > 99.9999;
+}
 
-    hue = sanitizeDegreesDouble( hue );
+static QRgb getRgb( const HueTerms& terms, double chroma, double tone )
+{
+    if ( isAchromatic( chroma, tone ) )
+        return argbFromLstar( tone );
 
-    const double hueRadians = hue / 180.0 * M_PI;
     const double y = yFromLstar( tone );
 
-    const QRgb rgb = findResultByJ( hueRadians, chroma, y );
+    const QRgb rgb = findResultByJ( terms, chroma, y );
     if ( rgb != 0 )
         return rgb;
 
-    const XYZ linrgb = bisectToLimit( y, hueRadians );
+    const XYZ linrgb = bisectToLimit( y, terms.radians );
     return argbFromLinrgb( linrgb );
 }
 
+static inline QRgb getRgb( double hue, double chroma, double tone )
+{
+    if ( isAchromatic( chroma, tone ) )
+        return argbFromLstar( tone );
+
+    return getRgb( HueTerms( sanitizeDegreesDouble( hue ) ), chroma, tone );
+}
+
 static const XYZ SRGB_TO_XYZ[3] =
 {
     { 0.41233895, 0.35762064, 0.18051042 },
@@ -885,6 +926,52 @@ QRgb QskHctColor::rgb() const
     return getRgb( m_hue, m_chroma, m_tone );
 }
 
+void QskHctColor::toRgb( const QskHctColor* colors, QRgb* rgb, int count )
+{
+    if ( count <= 0 )
+        return;
+
+    /*
+        Colors of the same hue, f.e. the tones of a palette, share
+        the trigonometric terms. So we calculate them only, when
+        the hue is changing.
+     */
+    HueTerms terms( sanitizeDegreesDouble( colors[0].m_hue ) );
+
+    for ( int i = 0; i < count; i++ )
+    {
+        const auto& color = colors[i];
+
+        if ( isAchromatic( color.m_chroma, color.m_tone ) )
+        {
+            rgb[i] = argbFromLstar( color.m_tone );
+            continue;
+        }
+
+        const auto hue = sanitizeDegreesDouble( color.m_hue );
+        if ( hue != terms.hue )
+            terms = HueTerms( hue );
+
+        rgb[i] = getRgb( terms, color.m_chroma, color.m_tone );
+    }
+}
+
+void QskHctColor::fromRgb( const QRgb* rgb, QskHctColor* colors, int count )
+{
+    for ( int i = 0; i < count; i++ )
+    {
+        auto& color = colors[i];
+
+        if ( i > 0 && rgb[i] == rgb[i - 1] )
+        {
+            color = colors[i - 1];
+            continue;
+        }
+
+        getHTC( rgb[i], color.m_hue, color.m_chroma, color.m_tone );
+    }
+}
+
 #ifndef QT_NO_DEBUG_STREAM
 
 #include <qdebug.h>
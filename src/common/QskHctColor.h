@@ -44,6 +44,10 @@ class QSK_EXPORT QskHctColor
     void setRgb( QRgb );
     QRgb rgb() const;
 
+    // batch conversions, faster than converting color by color
+    static void toRgb( const QskHctColor*, QRgb*, int count );
+    static void fromRgb( const QRgb*, QskHctColor*, int count );
+
   private:
     qreal m_hue = 0;    // [0.0, 360.0[
     qreal m_chroma = 0;
@@ -0,0 +1,142 @@
+/******************************************************************************
+ * QSkinny - Copyright (C) The authors
+ *           SPDX-License-Identifier: BSD-3-Clause
+ *****************************************************************************/
+
+#include "QskTonalPalette.h"
+#include "QskHctColor.h"
+
+#include <qhash.h>
+#include <qmutex.h>
+
+namespace
+{
+    using Table = std::shared_ptr< const QRgb >;
+
+    class Cache
+    {
+      public:
+        // we don't want to grow without limits, when seeds are dynamic
+        enum { Limit = 32 };
+
+        QMutex mutex;
+
+        QHash< QRgb, Table > tables;       // calculated on demand
+        QHash< QRgb, Table > staticTables; // inserted by the application
+    };
+}
+
+Q_GLOBAL_STATIC( Cache, qskCache )
+
+static Table qskCalculatedTable( const QskHctColor& color )
+{
+    QskHctColor colors[ QskTonalPalette::ToneCount ];
+    for ( int i = 0; i < QskTonalPalette::ToneCount; i++ )
+        colors[i] = color.toned( i );
+
+    auto tones = new QRgb[ QskTonalPalette::ToneCount ];
+    QskHctColor::toRgb( colors, tones, QskTonalPalette::ToneCount );
+
+    return Table( tones, std::default_delete< QRgb[] >() );
+}
+
+static Table qskCachedTable( QRgb seed )
+{
+    auto cache = qskCache();
+
+    QMutexLocker locker( &cache->mutex );
+
+    auto it = cache->staticTables.constFind( seed );
+    if ( it != cache->staticTables.constEnd() )
+        return it.value();
+
+    it = cache->tables.constFind( seed );
+    if ( it != cache->tables.constEnd() )
+        return it.value();
+
+    return Table();
+}
+
+static Table qskTable( QRgb seed )
+{
+    if ( auto table = qskCachedTable( seed ) )
+        return table;
+
+    auto cache = qskCache();
+
+    // calculating without blocking others
+    const auto table = qskCalculatedTable( QskHctColor( seed ) );
+
+    QMutexLocker locker( &cache->mutex );
+
+    if ( cache->tables.size() >= Cache::Limit )
+    {
+        // palettes in use keep their tables alive
+        cache->tables.clear();
+    }
+
+    cache->tables.insert( seed, table );
+
+    return table;
+}
+
+QskTonalPalette::QskTonalPalette() noexcept
+{
+}
+
+QskTonalPalette::QskTonalPalette( QRgb seed )
+    : m_seed( seed )
+    , m_tones( qskTable( seed ) )
+{
+}
+
+QskTonalPalette::QskTonalPalette( const QskHctColor& color )
+    : m_seed( color.rgb() )
+    , m_tones( qskCalculatedTable( color ) )
+{
+}
+
+QskTonalPalette::~QskTonalPalette()
+{
+}
+
+QRgb QskTonalPalette::rgb( int tone ) const noexcept
+{
+    if ( m_tones == nullptr )
+        return 0;
+
+    return m_tones.get()[ qBound( 0, tone, ToneCount - 1 ) ];
+}
+
+QskTonalPalette QskTonalPalette::fromCache( QRgb seed )
+{
+    QskTonalPalette palette;
+
+    palette.m_tones = qskCachedTable( seed );
+    if ( palette.m_tones )
+        palette.m_seed = seed;
+
+    return palette;
+}
+
+void QskTonalPalette::insertTable( QRgb seed, const QRgb* tones )
+{
+    if ( tones == nullptr )
+        return;
+
+    auto cache = qskCache();
+
+    QMutexLocker locker( &cache->mutex );
+
+    // the table is owned by the application
+    cache->staticTables.insert( seed, Table( tones, []( const QRgb* ) {} ) );
+    cache->tables.remove( seed );
+}
+
+void QskTonalPalette::clearCache()
+{
+    auto cache = qskCache();
+
+    QMutexLocker locker( &cache->mutex );
+    cache->tables.clear();
+}
@@ -0,0 +1,89 @@
+/******************************************************************************
+ * QSkinny - Copyright (C) The authors
+ *           SPDX-License-Identifier: BSD-3-Clause
+ *****************************************************************************/
+
+#ifndef QSK_TONAL_PALETTE_H
+#define QSK_TONAL_PALETTE_H
+
+#include "QskGlobal.h"
+#include <qcolor.h>
+#include <memory>
+
+class QskHctColor;
+
+/*
+    A lookup table of the tones [0, 100] for the hue/chroma of a seed color.
+
+    All tones are converted at once, when the palette is created. The tables
+    are shared between palettes of the same seed color, so that switching
+    between themes does not convert them again. Tables for well known seeds
+    can be precomputed and inserted with insertTable().
+ */
+class QSK_EXPORT QskTonalPalette
+{
+  public:
+    enum { ToneCount = 101 };
+
+    QskTonalPalette() noexcept;
+    QskTonalPalette( QRgb seed );
+
+    // not shared with other palettes
+    QskTonalPalette( const QskHctColor& );
+
+    ~QskTonalPalette();
+
+    bool isNull() const noexcept;
+
+    QRgb seed() const noexcept;
+
+    // tone is bounded to [0, 100]
+    QRgb rgb( int tone ) const noexcept;
+    QRgb operator[]( int tone ) const noexcept;
+
+    // ToneCount colors, or nullptr for a null palette
+    const QRgb* tones() const noexcept;
+
+    /*
+        The palette, when a table for seed has been inserted or calculated
+        before - otherwise a null palette. Useful when only a few tones
+        are needed and calculating the complete table does not pay off.
+     */
+    static QskTonalPalette fromCache( QRgb seed );
+
+    /*
+        Registering a precomputed table for seed. The table is
+        not copied and has to stay valid for the lifetime of the
+        application.
+     */
+    static void insertTable( QRgb seed, const QRgb* tones );
+
+    // releasing the cached tables, that have been calculated
+    static void clearCache();
+
+  private:
+    QRgb m_seed = 0;
+    std::shared_ptr< const QRgb > m_tones;
+};
+
+inline bool QskTonalPalette::isNull() const noexcept
+{
+    return m_tones == nullptr;
+}
+
+inline QRgb QskTonalPalette::seed() const noexcept
+{
+    return m_seed;
+}
+
+inline const QRgb* QskTonalPalette::tones() const noexcept
+{
+    return m_tones.get();
+}
+
+inline QRgb QskTonalPalette::operator[]( int tone ) const noexcept
+{
+    return rgb( tone );
+}
+
+#endif
@@ -27,6 +27,20 @@ QRectF QskBoxSkinlet::subControlRect( const QskSkinnable* skinnable,
     return Inherited::subControlRect( skinnable, contentsRect, subControl );
 }
 
+QRectF QskBoxSkinlet::opaqueRect( const QskSkinnable* skinnable ) const
+{
+    const auto box = static_cast< const QskBox* >( skinnable );
+
+    if ( box->hasPanel() )
+    {
+        const auto rect = opaqueBoxRect( box, QskBox::Panel );
+        if ( !rect.isEmpty() )
+            return rect;
+    }
+
+    return Inherited::opaqueRect( skinnable );
+}
+
 QSGNode* QskBoxSkinlet::updateSubNode(
     const QskSkinnable* skinnable, quint8 nodeRole, QSGNode* node ) const
 {
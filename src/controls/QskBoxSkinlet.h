@@ -27,6 +27,8 @@ class QSK_EXPORT QskBoxSkinlet : public QskSkinlet
     QRectF subControlRect( const QskSkinnable*,
         const QRectF&, QskAspect::Subcontrol ) const override;
 
+    QRectF opaqueRect( const QskSkinnable* ) const override;
+
     QSizeF sizeHint( const QskSkinnable*,
         Qt::SizeHint, const QSizeF& ) const override;
 
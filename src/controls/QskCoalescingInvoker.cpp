@@ -0,0 +1,331 @@
+/******************************************************************************
+ * QSkinny - Copyright (C) The authors
+ *           SPDX-License-Identifier: BSD-3-Clause
+ *****************************************************************************/
+
+#include "QskCoalescingInvoker.h"
+#include "QskMetaInvokable.h"
+
+#include <qatomic.h>
+#include <qdebug.h>
+#include <qmetaobject.h>
+#include <qpointer.h>
+#include <qquickwindow.h>
+#include <qvariant.h>
+
+#include <vector>
+
+namespace
+{
+    class Value
+    {
+      public:
+        QVariant variant;
+    };
+
+    class Counter : public QAtomicInteger< quint64 >
+    {
+      public:
+        inline void increment() { fetchAndAddRelaxed( 1 ); }
+        inline quint64 value() const { return loadRelaxed(); }
+        inline void reset() { storeRelaxed( 0 ); }
+    };
+}
+
+static inline bool qskConvert( QVariant& value, int type )
+{
+    if ( type == QMetaType::UnknownType || type == QMetaType::QVariant )
+        return true;
+
+    if ( value.userType() == type )
+        return true;
+
+#if QT_VERSION >= QT_VERSION_CHECK( 6, 0, 0 )
+    return value.convert( QMetaType( type ) );
+#else
+    return value.convert( type );
+#endif
+}
+
+class QskCoalescingInvoker::Channel
+{
+  public:
+    Channel( QObject* receiver, const QskMetaInvokable& invokable )
+        : receiver( receiver )
+        , invokable( invokable )
+        , parameterType( invokable.parameterType( 0 ) )
+    {
+    }
+
+    ~Channel()
+    {
+        delete pending.loadRelaxed();
+        delete spare.loadRelaxed();
+    }
+
+    inline void recycle( Value* value )
+    {
+        // keeping one container for the next post, when possible
+        delete spare.fetchAndStoreRelaxed( value );
+    }
+
+    inline Value* takeValue()
+    {
+        auto value = spare.fetchAndStoreRelaxed( nullptr );
+        return value ? value : new Value();
+    }
+
+    // only accessed from the GUI thread
+    QPointer< QObject > receiver;
+    QskMetaInvokable invokable;
+    const int parameterType;
+
+    // the latest value, that has not been delivered yet
+    QAtomicPointer< Value > pending;
+    QAtomicPointer< Value > spare;
+
+    /*
+        The link of the intrusive MPSC queue. A channel is enqueued,
+        when pending changes from nullptr to a value. So it can't be in
+        the queue twice and next is written by one thread only.
+     */
+    Channel* next = nullptr;
+};
+
+class QskCoalescingInvoker::PrivateData
+{
+  public:
+    QPointer< QQuickWindow > window;
+    std::vector< std::unique_ptr< Channel > > channels;
+
+    // a lock-free stack of the channels with pending values
+    QAtomicPointer< Channel > head;
+
+    Counter postCount;
+    Counter deliveryCount;
+    Counter coalescedCount;
+    Counter droppedCount;
+    Counter flushCount;
+};
+
+QskCoalescingInvoker::QskCoalescingInvoker( QObject* parent )
+    : Inherited( parent )
+    , m_data( new PrivateData() )
+{
+}
+
+QskCoalescingInvoker::~QskCoalescingInvoker()
+{
+}
+
+void QskCoalescingInvoker::setWindow( QQuickWindow* window )
+{
+    if ( window == m_data->window )
+        return;
+
+    if ( m_data->window )
+    {
+        disconnect( m_data->window, &QQuickWindow::afterAnimating,
+            this, &QskCoalescingInvoker::flush );
+    }
+
+    m_data->window = window;
+
+    if ( window )
+    {
+        connect( window, &QQuickWindow::afterAnimating,
+            this, &QskCoalescingInvoker::flush, Qt::DirectConnection );
+    }
+}
+
+QQuickWindow* QskCoalescingInvoker::window() const
+{
+    return m_data->window;
+}
+
+QskCoalescingInvoker::Channel* QskCoalescingInvoker::addChannel(
+    QObject* receiver, const char* propertyName )
+{
+    if ( receiver == nullptr )
+        return nullptr;
+
+    const auto metaObject = receiver->metaObject();
+    return addChannel( receiver,
+        metaObject->property( metaObject->indexOfProperty( propertyName ) ) );
+}
+
+QskCoalescingInvoker::Channel* QskCoalescingInvoker::addChannel(
+    QObject* receiver, const QMetaProperty& property )
+{
+    if ( !property.isWritable() )
+    {
+        qWarning() << "QskCoalescingInvoker: property is not writable:"
+            << property.name();
+        return nullptr;
+    }
+
+    return addChannel( receiver, QskMetaInvokable( property ) );
+}
+
+QskCoalescingInvoker::Channel* QskCoalescingInvoker::addChannel(
+    QObject* receiver, const QskMetaInvokable& invokable )
+{
+    if ( receiver == nullptr || invokable.isNull() )
+        return nullptr;
+
+    if ( invokable.parameterCount() != 1 )
+    {
+        qWarning() << "QskCoalescingInvoker: invalid number of parameters:"
+            << invokable.name();
+        return nullptr;
+    }
+
+    auto channel = new Channel( receiver, invokable );
+    m_data->channels.emplace_back( channel );
+
+    return channel;
+}
+
+void QskCoalescingInvoker::post( Channel* channel, const QVariant& value )
+{
+    if ( channel == nullptr )
+        return;
+
+    m_data->postCount.increment();
+
+    auto v = channel->takeValue();
+    v->variant = value;
+
+    if ( !qskConvert( v->variant, channel->parameterType ) )
+    {
+        m_data->droppedCount.increment();
+        channel->recycle( v );
+
+        return;
+    }
+
+    if ( auto old = channel->pending.fetchAndStoreOrdered( v ) )
+    {
+        // the previous value has not been delivered yet
+        m_data->coalescedCount.increment();
+        channel->recycle( old );
+
+        return;
+    }
+
+    auto& head = m_data->head;
+
+    auto oldHead = head.loadRelaxed();
+
+    do
+    {
+        channel->next = oldHead;
+    }
+    while ( !head.testAndSetRelease( oldHead, channel, oldHead ) );
+
+    if ( oldHead == nullptr )
+    {
+        // the first pending channel since the last flush
+        scheduleFlush();
+    }
+}
+
+void QskCoalescingInvoker::scheduleFlush()
+{
+    /*
+        Called from any thread: we only post an event, when the queue
+        changes from being empty, what happens at most once per frame.
+
+        The window is a QPointer, that must not be read from other threads:
+        so it is looked up, when the event is delivered in the GUI thread.
+     */
+    QMetaObject::invokeMethod( this,
+        [ this ]
+        {
+            if ( auto window = m_data->window.data() )
+                window->update();
+            else
+                flush();
+        },
+        Qt::QueuedConnection );
+}
+
+void QskCoalescingInvoker::flush()
+{
+    auto channel = m_data->head.fetchAndStoreAcquire( nullptr );
+    if ( channel == nullptr )
+        return;
+
+    m_data->flushCount.increment();
+
+    // the stack is in reverse order of the posts
+
+    Channel* first = nullptr;
+    while ( channel )
+    {
+        auto next = channel->next;
+
+        channel->next = first;
+        first = channel;
+
+        channel = next;
+    }
+
+    for ( channel = first; channel != nullptr; )
+    {
+        /*
+            As soon as pending has been reset the channel might
+            be enqueued again: so we have to read next before.
+         */
+        auto next = channel->next;
+
+        if ( auto value = channel->pending.fetchAndStoreAcquire( nullptr ) )
+        {
+            if ( auto receiver = channel->receiver.data() )
+            {
+                void* args[] = { nullptr, nullptr };
+
+                if ( channel->parameterType == QMetaType::QVariant )
+                    args[1] = &value->variant;
+                else
+                    args[1] = value->variant.data();
+
+                channel->invokable.invoke( receiver, args, Qt::DirectConnection );
+
+                m_data->deliveryCount.increment();
+            }
+            else
+            {
+                m_data->droppedCount.increment();
+            }
+
+            channel->recycle( value );
+        }
+
+        channel = next;
+    }
+}
+
+QskCoalescingInvoker::Statistics QskCoalescingInvoker::statistics() const
+{
+    Statistics statistics;
+
+    statistics.postCount = m_data->postCount.value();
+    statistics.deliveryCount = m_data->deliveryCount.value();
+    statistics.coalescedCount = m_data->coalescedCount.value();
+    statistics.droppedCount = m_data->droppedCount.value();
+    statistics.flushCount = m_data->flushCount.value();
+
+    return statistics;
+}
+
+void QskCoalescingInvoker::resetStatistics()
+{
+    m_data->postCount.reset();
+    m_data->deliveryCount.reset();
+    m_data->coalescedCount.reset();
+    m_data->droppedCount.reset();
+    m_data->flushCount.reset();
+}
+
+#include "moc_QskCoalescingInvoker.cpp"
@@ -0,0 +1,86 @@
+/******************************************************************************
+ * QSkinny - Copyright (C) The authors
+ *           SPDX-License-Identifier: BSD-3-Clause
+ *****************************************************************************/
+
+#ifndef QSK_COALESCING_INVOKER_H
+#define QSK_COALESCING_INVOKER_H
+
+#include "QskGlobal.h"
+#include <qobject.h>
+#include <memory>
+
+class QskMetaInvokable;
+class QQuickWindow;
+class QMetaProperty;
+class QVariant;
+
+/*
+    QskCoalescingInvoker passes values from worker threads to
+    receivers living in the GUI thread, when only the latest value
+    is of interest - f.e. telemetry data, that is displayed in controls.
+
+    Each ( receiver, property/method ) pair is a channel. Posting a value
+    to a channel is lock-free and does not post any event: the value is
+    stored in the channel, replacing a value, that has not been delivered yet,
+    and the channel is enqueued into a lock-free MPSC queue. The queue is
+    drained once per frame from QQuickWindow::afterAnimating, or - without
+    a window - from a queued call to flush().
+
+    The value containers are recycled, so that posting values of types,
+    that fit into a QVariant, does not allocate in the steady state.
+
+    Channels have to be added in the GUI thread, before posting values to
+    them. The invoker has to outlive all threads, that are posting values.
+ */
+class QSK_EXPORT QskCoalescingInvoker : public QObject
+{
+    Q_OBJECT
+
+    using Inherited = QObject;
+
+  public:
+    class Channel;
+
+    class Statistics
+    {
+      public:
+        quint64 postCount = 0;      // values, that have been posted
+        quint64 deliveryCount = 0;  // values, that have been delivered
+        quint64 coalescedCount = 0; // values replaced before being delivered
+        quint64 droppedCount = 0;   // no receiver or conversion failed
+        quint64 flushCount = 0;     // number of times the queue has been drained
+    };
+
+    QskCoalescingInvoker( QObject* parent = nullptr );
+    ~QskCoalescingInvoker() override;
+
+    // the queue is drained, when the window is about to render a frame
+    void setWindow( QQuickWindow* );
+    QQuickWindow* window() const;
+
+    // GUI thread only
+    Channel* addChannel( QObject* receiver, const char* propertyName );
+    Channel* addChannel( QObject* receiver, const QMetaProperty& );
+
+    // methods/functions with exactly one parameter
+    Channel* addChannel( QObject* receiver, const QskMetaInvokable& );
+
+    // thread safe
+    void post( Channel*, const QVariant& );
+
+    Statistics statistics() const;
+    void resetStatistics();
+
+  public Q_SLOTS:
+    // delivering the pending values: GUI thread only
+    void flush();
+
+  private:
+    void scheduleFlush();
+
+    class PrivateData;
+    std::unique_ptr< PrivateData > m_data;
+};
+
+#endif
@@ -952,6 +952,12 @@ void QskControl::geometryChange(
 
 void QskControl::updateItemPolish()
 {
+    /*
+        The scene graph thread reads the hint table of the skin
+        without populating it. So we have to do it in advance.
+     */
+    populateSkinHints();
+
     updateResources(); // an extra dirty bit for this ???
 
     if ( width() >= 0.0 || height() >= 0.0 )
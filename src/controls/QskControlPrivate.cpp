@@ -175,6 +175,12 @@ void QskControlPrivate::layoutConstraintChanged()
     }
 }
 
+void QskControlPrivate::releaseSkin()
+{
+    q_func()->resetCachedSkinlet();
+    Inherited::releaseSkin();
+}
+
 void QskControlPrivate::implicitSizeChanged()
 {
     if ( !( explicitSizeHints && explicitSizeHints[ Qt::PreferredSize ].isValid() ) )
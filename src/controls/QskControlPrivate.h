@@ -21,6 +21,8 @@ class QskControlPrivate : public QskQuickItemPrivate
     static bool inheritSection( QskControl*, QskAspect::Section );
     static void resolveSection( QskControl* );
 
+    void releaseSkin() override final;
+
   protected:
     QskControlPrivate();
     ~QskControlPrivate() override;
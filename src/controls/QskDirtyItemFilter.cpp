@@ -5,12 +5,25 @@
 
 #include "QskDirtyItemFilter.h"
 #include "QskQuickItem.h"
+#include "QskQuickItemPrivate.h"
+#include "QskControl.h"
+#include "QskSkinlet.h"
 
 QSK_QT_PRIVATE_BEGIN
 #include <private/qquickitem_p.h>
 #include <private/qquickwindow_p.h>
 QSK_QT_PRIVATE_END
 
+static inline bool qskIsViewportCulled( const QQuickItem* item )
+{
+    if ( !QskQuickItemPrivate::isViewportCulled( item ) )
+        return false;
+
+    // the item node has to be updated for hiding the subtree
+    const auto d = QQuickItemPrivate::get( item );
+    return !( d->dirtyAttributes & QQuickItemPrivate::HideReference );
+}
+
 static inline bool qskIsUpdateBlocked( const QQuickItem* item )
 {
     if ( !item->isVisible() )
@@ -18,6 +31,19 @@ static inline bool qskIsUpdateBlocked( const QQuickItem* item )
         if ( auto qskItem = qobject_cast< const QskQuickItem* >( item ) )
             return qskItem->testUpdateFlag( QskQuickItem::DeferredUpdate );
     }
+    else if ( auto qskItem = qobject_cast< const QskQuickItem* >( item ) )
+    {
+        if ( qskItem->isOccluded() )
+            return true;
+
+        if ( qskItem->testUpdateFlag( QskQuickItem::DeferredUpdate ) )
+            return qskIsViewportCulled( item );
+    }
+    else
+    {
+        // see QskScrollArea::viewportCulling
+        return qskIsViewportCulled( item );
+    }
 
 #if 0
     /*
@@ -47,8 +73,201 @@ static inline void qskBlockDirty( QQuickItem* item, bool on )
         qskBlockDirty( child, on );
 }
 
+static inline bool qskIsContentOnly( const QQuickItem* item )
+{
+    // changes, that have no effect on the geometry of the items
+    const quint32 mask = QQuickItemPrivate::Content
+        | QQuickItemPrivate::Smooth | QQuickItemPrivate::Antialiasing;
+
+    return ( QQuickItemPrivate::get( item )->dirtyAttributes & ~mask ) == 0;
+}
+
 namespace
 {
+    /*
+        Traversing the items front to back and collecting the rectangles
+        of opaque controls ( see QskSkinlet::opaqueRect ). Items, that are
+        completely behind one of these rectangles are occluded.
+
+        For the sake of simplicity we only take care of items, that are
+        not rotated, and do not try to combine several rectangles.
+
+        The culler is a child of the window, so that it is deleted together
+        with it. It is only accessed from beforeSynchronizing, while
+        the GUI thread is blocked.
+     */
+    class OcclusionCuller : public QObject
+    {
+        Q_OBJECT
+
+      public:
+        OcclusionCuller( QQuickWindow* window )
+            : QObject( window )
+        {
+        }
+
+        void cull( QQuickWindow* window )
+        {
+            if ( !needsUpdate( window ) )
+                return;
+
+            m_occluders.clear();
+            m_occluderItems.clear();
+
+            const QRectF sceneRect( 0.0, 0.0, window->width(), window->height() );
+            cull( window->contentItem(), sceneRect, true );
+
+            m_isValid = true;
+        }
+
+      private:
+        bool needsUpdate( const QQuickWindow* ) const;
+
+        void cull( QQuickItem*, const QRectF& clipRect, bool canOcclude );
+        void updateOcclusion( QQuickItem*, const QRectF& rect,
+            const QRectF& clipRect, bool canOcclude );
+
+        bool isCovered( const QRectF& rect ) const
+        {
+            for ( const auto& occluder : m_occluders )
+            {
+                if ( occluder.contains( rect ) )
+                    return true;
+            }
+
+            return false;
+        }
+
+        // usually the occluders are big and only a few of them are relevant
+        enum { MaxOccluders = 16 };
+
+        QVector< QRectF > m_occluders;
+        QSet< const QQuickItem* > m_occluderItems;
+
+        bool m_isValid = false;
+    };
+
+    bool OcclusionCuller::needsUpdate( const QQuickWindow* window ) const
+    {
+        if ( !m_isValid )
+            return true;
+
+        /*
+            The result of the previous frame is still valid, as long as
+            no item has been moved, resized, hidden, restacked ...
+
+            Content changes are only relevant for the occluders, as their
+            opaque rectangle might be gone. An item, that becomes opaque
+            is not found before the next update - what only means,
+            that we might be culling less for a while.
+         */
+
+        auto d = QQuickWindowPrivate::get( window );
+
+        for ( auto item = d->dirtyItemList; item != nullptr;
+            item = QQuickItemPrivate::get( item )->nextDirtyItem )
+        {
+            if ( !qskIsContentOnly( item ) || m_occluderItems.contains( item ) )
+                return true;
+
+            if ( auto qskItem = qobject_cast< const QskQuickItem* >( item ) )
+            {
+                // the flag has been disabled
+                if ( qskItem->isOccluded()
+                    && !qskItem->testUpdateFlag( QskQuickItem::OcclusionCulling ) )
+                {
+                    return true;
+                }
+            }
+        }
+
+        return false;
+    }
+
+    void OcclusionCuller::cull( QQuickItem* item,
+        const QRectF& clipRect, bool canOcclude )
+    {
+        if ( !item->isVisible() || item->opacity() <= 0.0 )
+            return;
+
+        auto d = QQuickItemPrivate::get( item );
+
+        const auto transform = item->itemTransform( nullptr, nullptr );
+        const bool isAligned = transform.type() <= QTransform::TxScale;
+
+        QRectF rect;
+        if ( isAligned )
+            rect = transform.mapRect( item->boundingRect() ) & clipRect;
+
+        if ( item->opacity() < 1.0 || !isAligned )
+            canOcclude = false;
+
+        if ( d->extra.isAllocated() && d->extra->layer && d->extra->layer->enabled() )
+            canOcclude = false; // the layer might have an effect
+
+        auto childClipRect = clipRect;
+        if ( item->clip() )
+        {
+            if ( isAligned )
+                childClipRect = rect;
+            else
+                canOcclude = false;
+        }
+
+        const auto children = d->paintOrderChildItems();
+
+        // in reverse paint order: children with z >= 0, item, children with z < 0
+
+        int i = children.count() - 1;
+
+        for ( ; i >= 0 && children[i]->z() >= 0.0; i-- )
+            cull( children[i], childClipRect, canOcclude );
+
+        updateOcclusion( item, rect, childClipRect, canOcclude );
+
+        // children might exceed the geometry of the item
+        for ( ; i >= 0; i-- )
+            cull( children[i], childClipRect, canOcclude );
+    }
+
+    void OcclusionCuller::updateOcclusion( QQuickItem* item,
+        const QRectF& rect, const QRectF& clipRect, bool canOcclude )
+    {
+        const auto control = qskControlCast( item );
+        if ( control == nullptr )
+            return;
+
+        bool occluded = false;
+
+        if ( control->testUpdateFlag( QskQuickItem::OcclusionCulling ) )
+            occluded = !rect.isEmpty() && isCovered( rect );
+
+        auto d = static_cast< QskQuickItemPrivate* >( QQuickItemPrivate::get( control ) );
+        d->setOccluded( occluded );
+
+        if ( occluded )
+            return;
+
+        const auto skinlet = control->effectiveSkinlet();
+
+        if ( skinlet && canOcclude && m_occluders.count() < MaxOccluders )
+        {
+            auto opaqueRect = skinlet->opaqueRect( control );
+            if ( !opaqueRect.isEmpty() )
+            {
+                // f.e the overlay of a popup exceeds the geometry of the item
+                const auto transform = control->itemTransform( nullptr, nullptr );
+                opaqueRect = transform.mapRect( opaqueRect ) & clipRect;
+
+                if ( !opaqueRect.isEmpty() )
+                {
+                    m_occluders += opaqueRect;
+                    m_occluderItems += control;
+                }
+            }
+        }
+    }
+
     class ResetBlockedDirtyJob final : public QRunnable
     {
       public:
@@ -97,12 +316,45 @@ void QskDirtyItemFilter::addWindow( QQuickWindow* window )
         window, [ this, window ] { beforeSynchronizing( window ); },
         Qt::DirectConnection );
 
-    connect( window, &QObject::destroyed,
-        this, [ this, window ] { m_windows.remove( window ); } );
+    connect( window, &QObject::destroyed, this,
+        [ this, window ] { m_windows.remove( window ); } );
+}
+
+static inline OcclusionCuller* qskOcclusionCuller( const QQuickWindow* window )
+{
+    return window->findChild< OcclusionCuller* >(
+        QString(), Qt::FindDirectChildrenOnly );
+}
+
+void QskDirtyItemFilter::setOcclusionCulling( QQuickWindow* window, bool on )
+{
+    auto culler = qskOcclusionCuller( window );
+
+    if ( on )
+    {
+        if ( culler == nullptr )
+            ( void ) new OcclusionCuller( window );
+    }
+    else
+    {
+        delete culler;
+    }
 }
 
 void QskDirtyItemFilter::beforeSynchronizing( QQuickWindow* window )
 {
+    if ( QQuickWindowPrivate::get( window )->renderer != nullptr )
+    {
+        if ( auto culler = qskOcclusionCuller( window ) )
+        {
+            /*
+                Items, that are not occluded anymore are inserted into
+                the dirty list again. So we need to do this before filtering.
+             */
+            culler->cull( window );
+        }
+    }
+
     filterDirtyList( window, qskIsUpdateBlocked );
 
     if ( QQuickWindowPrivate::get( window )->renderer == nullptr )
@@ -137,3 +389,5 @@ void QskDirtyItemFilter::filterDirtyList(
         item = nextItem;
     }
 }
+
+#include "QskDirtyItemFilter.moc"
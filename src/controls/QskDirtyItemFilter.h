@@ -24,6 +24,9 @@ class QskDirtyItemFilter : public QObject
 
     void addWindow( QQuickWindow* window );
 
+    // see QskQuickItem::OcclusionCulling
+    void setOcclusionCulling( QQuickWindow*, bool on );
+
     static void filterDirtyList( QQuickWindow*,
         bool ( *isBlocked )( const QQuickItem* ) );
 
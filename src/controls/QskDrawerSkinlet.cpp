@@ -24,6 +24,16 @@ QRectF QskDrawerSkinlet::subControlRect(
     return Inherited::subControlRect( skinnable, contentsRect, subControl );
 }
 
+QRectF QskDrawerSkinlet::opaqueRect( const QskSkinnable* skinnable ) const
+{
+    // an opaque overlay covers more than the panel
+    auto rect = Inherited::opaqueRect( skinnable );
+    if ( rect.isEmpty() )
+        rect = opaqueBoxRect( skinnable, QskDrawer::Panel );
+
+    return rect;
+}
+
 QSGNode* QskDrawerSkinlet::updateSubNode(
     const QskSkinnable* skinnable, quint8 nodeRole, QSGNode* node ) const
 {
@@ -29,6 +29,8 @@ class QSK_EXPORT QskDrawerSkinlet : public QskPopupSkinlet
     QRectF subControlRect( const QskSkinnable*,
         const QRectF&, QskAspect::Subcontrol ) const override;
 
+    QRectF opaqueRect( const QskSkinnable* ) const override;
+
     QSizeF sizeHint( const QskSkinnable*,
         Qt::SizeHint, const QSizeF& ) const override;
 
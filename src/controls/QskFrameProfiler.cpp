@@ -0,0 +1,555 @@
+/******************************************************************************
+ * QSkinny - Copyright (C) The authors
+ *           SPDX-License-Identifier: BSD-3-Clause
+ *****************************************************************************/
+
+#include "QskFrameProfiler.h"
+
+#include <qatomic.h>
+#include <qdebug.h>
+#include <qelapsedtimer.h>
+#include <qfile.h>
+#include <qhash.h>
+#include <qmutex.h>
+#include <qquickitem.h>
+#include <qquickwindow.h>
+
+static QAtomicInt qskProfilerCount;
+
+namespace
+{
+    class ProfilerRegistry
+    {
+      public:
+        void insert( const QQuickWindow* window, QskFrameProfiler* profiler )
+        {
+            QMutexLocker locker( &m_mutex );
+            m_profilers.insert( window, profiler );
+        }
+
+        void remove( const QQuickWindow* window, const QskFrameProfiler* profiler )
+        {
+            QMutexLocker locker( &m_mutex );
+
+            auto it = m_profilers.find( window );
+            if ( it != m_profilers.end() && it.value() == profiler )
+                m_profilers.erase( it );
+        }
+
+        QskFrameProfiler* profiler( const QQuickWindow* window ) const
+        {
+            QMutexLocker locker( &m_mutex );
+            return m_profilers.value( window, nullptr );
+        }
+
+      private:
+        mutable QMutex m_mutex;
+        QHash< const QQuickWindow*, QskFrameProfiler* > m_profilers;
+    };
+
+    template< typename T >
+    class RingBuffer
+    {
+      public:
+        RingBuffer( int capacity )
+        {
+            setCapacity( capacity );
+        }
+
+        void setCapacity( int capacity )
+        {
+            m_capacity = qMax( capacity, 1 );
+            clear();
+        }
+
+        inline int capacity() const
+        {
+            return m_capacity;
+        }
+
+        void clear()
+        {
+            m_values.clear();
+            m_next = 0;
+        }
+
+        void append( const T& value )
+        {
+            if ( m_values.size() < m_capacity )
+            {
+                m_values += value;
+            }
+            else
+            {
+                m_values[ m_next ] = value;
+                m_next = ( m_next + 1 ) % m_capacity;
+            }
+        }
+
+        QVector< T > toVector() const
+        {
+            if ( m_next == 0 )
+                return m_values;
+
+            QVector< T > values;
+            values.reserve( m_values.size() );
+
+            values += m_values.mid( m_next );
+            values += m_values.mid( 0, m_next );
+
+            return values;
+        }
+
+      private:
+        int m_capacity;
+        int m_next;
+
+        QVector< T > m_values;
+    };
+
+    class Event
+    {
+      public:
+        // nullptr for the phases of a frame
+        const char* className;
+
+        qint64 startTime;
+        qint64 duration;
+
+        qint16 nodeRole;
+        quint8 phase;
+    };
+
+    class RecordKey
+    {
+      public:
+        inline bool operator==( const RecordKey& other ) const
+        {
+            return ( className == other.className )
+                && ( nodeRole == other.nodeRole ) && ( phase == other.phase );
+        }
+
+        const char* className;
+        int nodeRole;
+        int phase;
+    };
+
+    inline QskHashValue qHash( const RecordKey& key, QskHashValue seed = 0 ) noexcept
+    {
+        const auto value = ( key.nodeRole + 1 ) * QskFrameProfiler::PhaseCount + key.phase;
+        return ::qHash( reinterpret_cast< quintptr >( key.className ), seed )
+            ^ ::qHash( value, seed );
+    }
+}
+
+Q_GLOBAL_STATIC( ProfilerRegistry, qskProfilerRegistry )
+
+static const char* qskPhaseName( int phase )
+{
+    static const char* names[] = { "Polish", "Sync", "Render", "Swap" };
+    return names[ phase ];
+}
+
+static void qskUnregister( const QQuickWindow* window, const QskFrameProfiler* profiler )
+{
+    if ( qskProfilerRegistry.exists() )
+    {
+        if ( QskFrameProfiler::profiler( window ) == profiler )
+        {
+            qskProfilerRegistry->remove( window, profiler );
+            qskProfilerCount.deref();
+        }
+    }
+}
+
+static inline int qskThreadId( int phase )
+{
+    // polishing happens in the GUI thread, everything else in the scene graph thread
+    return ( phase == QskFrameProfiler::Polish ) ? 1 : 2;
+}
+
+class QskFrameProfiler::PrivateData
+{
+  public:
+    PrivateData( QQuickWindow* window )
+        : window( window )
+        , frames( 600 )
+        , events( 50000 )
+    {
+        clock.start();
+    }
+
+    void addEvent( const char* className, int nodeRole,
+        int phase, qint64 startTime, qint64 duration )
+    {
+        Event event;
+        event.className = className;
+        event.startTime = startTime;
+        event.duration = duration;
+        event.nodeRole = static_cast< qint16 >( nodeRole );
+        event.phase = static_cast< quint8 >( phase );
+
+        events.append( event );
+    }
+
+    QQuickWindow* window;
+    QElapsedTimer clock;
+
+    mutable QMutex mutex;
+
+    RingBuffer< Frame > frames;
+    RingBuffer< Event > events;
+
+    QHash< RecordKey, Record > records;
+
+    quint64 frameNumber = 0;
+
+    // time of the node roles of the item, that is currently synchronized
+    qint64 roleTime = 0;
+
+    qint64 polishStart = -1;
+
+    // the frame, that is currently processed by the scene graph
+    Frame frame;
+    qint64 syncStart = -1;
+    qint64 renderStart = -1;
+    qint64 renderEnd = -1;
+};
+
+qint64 QskFrameProfiler::Frame::duration() const
+{
+    qint64 value = 0;
+    for ( const auto time : phaseTime )
+        value += time;
+
+    return value;
+}
+
+QskFrameProfiler::QskFrameProfiler( QQuickWindow* window )
+    : Inherited( window )
+    , m_data( new PrivateData( window ) )
+{
+    Q_ASSERT( window );
+
+    /*
+        The scene graph might run on a different thread and we
+        need direct connections to get the timing right.
+     */
+
+    connect( window, &QQuickWindow::afterAnimating,
+        this, [ this ] { startPolishing(); }, Qt::DirectConnection );
+
+    connect( window, &QQuickWindow::beforeSynchronizing,
+        this, [ this ] { startSynchronizing(); }, Qt::DirectConnection );
+
+    connect( window, &QQuickWindow::afterSynchronizing,
+        this, [ this ] { finishSynchronizing(); }, Qt::DirectConnection );
+
+    connect( window, &QQuickWindow::beforeRendering,
+        this, [ this ] { startRendering(); }, Qt::DirectConnection );
+
+    connect( window, &QQuickWindow::afterRendering,
+        this, [ this ] { finishRendering(); }, Qt::DirectConnection );
+
+    connect( window, &QQuickWindow::frameSwapped,
+        this, [ this ] { finishFrame(); }, Qt::DirectConnection );
+
+    if ( auto other = profiler( window ) )
+    {
+        qWarning() << "QskFrameProfiler: replacing the profiler of" << window;
+        qskProfilerRegistry->remove( window, other );
+    }
+    else
+    {
+        qskProfilerCount.ref();
+    }
+
+    qskProfilerRegistry->insert( window, this );
+}
+
+QskFrameProfiler::~QskFrameProfiler()
+{
+    qskUnregister( m_data->window, this );
+}
+
+QskFrameProfiler* QskFrameProfiler::profiler( const QQuickWindow* window )
+{
+    if ( window == nullptr || qskProfilerCount.loadRelaxed() == 0 )
+        return nullptr;
+
+    return qskProfilerRegistry->profiler( window );
+}
+
+QQuickWindow* QskFrameProfiler::window() const
+{
+    return m_data->window;
+}
+
+void QskFrameProfiler::detach()
+{
+    qskUnregister( m_data->window, this );
+
+    // the connections might still be in use by the scene graph thread
+    disconnect( m_data->window, nullptr, this, nullptr );
+}
+
+void QskFrameProfiler::setFrameCapacity( int capacity )
+{
+    QMutexLocker locker( &m_data->mutex );
+    m_data->frames.setCapacity( capacity );
+}
+
+int QskFrameProfiler::frameCapacity() const
+{
+    QMutexLocker locker( &m_data->mutex );
+    return m_data->frames.capacity();
+}
+
+void QskFrameProfiler::setEventCapacity( int capacity )
+{
+    QMutexLocker locker( &m_data->mutex );
+    m_data->events.setCapacity( capacity );
+}
+
+int QskFrameProfiler::eventCapacity() const
+{
+    QMutexLocker locker( &m_data->mutex );
+    return m_data->events.capacity();
+}
+
+QVector< QskFrameProfiler::Frame > QskFrameProfiler::frames() const
+{
+    QMutexLocker locker( &m_data->mutex );
+    return m_data->frames.toVector();
+}
+
+QVector< QskFrameProfiler::Record > QskFrameProfiler::records() const
+{
+    QMutexLocker locker( &m_data->mutex );
+
+    QVector< Record > records;
+    records.reserve( m_data->records.size() );
+
+    for ( const auto& record : std::as_const( m_data->records ) )
+        records += record;
+
+    return records;
+}
+
+void QskFrameProfiler::reset()
+{
+    QMutexLocker locker( &m_data->mutex );
+
+    m_data->frames.clear();
+    m_data->events.clear();
+    m_data->records.clear();
+}
+
+qint64 QskFrameProfiler::timestamp() const
+{
+    return m_data->clock.nsecsElapsed();
+}
+
+void QskFrameProfiler::addItemTiming( const QQuickItem* item,
+    Phase phase, qint64 startTime, int nodeRole )
+{
+    const auto duration = timestamp() - startTime;
+    const auto className = item->metaObject()->className();
+
+    QMutexLocker locker( &m_data->mutex );
+
+    /*
+        The node roles are updated from the updatePaintNode call
+        of the item: the records contain exclusive times, so that
+        the time of the roles is not counted twice.
+     */
+    auto time = duration;
+
+    if ( phase == Sync )
+    {
+        if ( nodeRole >= 0 )
+        {
+            m_data->roleTime += duration;
+        }
+        else
+        {
+            time = qMax( time - m_data->roleTime, qint64( 0 ) );
+            m_data->roleTime = 0;
+        }
+    }
+
+    auto& record = m_data->records[ { className, nodeRole, phase } ];
+    if ( record.count == 0 )
+    {
+        record.className = className;
+        record.nodeRole = nodeRole;
+        record.phase = phase;
+    }
+
+    record.count++;
+    record.time += time;
+    record.maximum = qMax( record.maximum, time );
+
+    m_data->addEvent( className, nodeRole, phase, startTime, duration );
+}
+
+void QskFrameProfiler::startPolishing()
+{
+    QMutexLocker locker( &m_data->mutex );
+    m_data->polishStart = timestamp();
+}
+
+void QskFrameProfiler::startSynchronizing()
+{
+    const auto now = timestamp();
+
+    QMutexLocker locker( &m_data->mutex );
+
+    auto& frame = m_data->frame;
+
+    frame = Frame();
+    frame.number = ++m_data->frameNumber;
+
+    if ( m_data->polishStart >= 0 )
+    {
+        frame.timestamp = m_data->polishStart;
+        frame.phaseTime[ Polish ] = now - m_data->polishStart;
+
+        m_data->addEvent( nullptr, -1, Polish,
+            m_data->polishStart, frame.phaseTime[ Polish ] );
+    }
+    else
+    {
+        frame.timestamp = now;
+    }
+
+    m_data->polishStart = -1;
+    m_data->syncStart = now;
+    m_data->renderStart = m_data->renderEnd = -1;
+}
+
+void QskFrameProfiler::finishSynchronizing()
+{
+    const auto now = timestamp();
+
+    QMutexLocker locker( &m_data->mutex );
+
+    if ( m_data->syncStart >= 0 )
+    {
+        m_data->frame.phaseTime[ Sync ] = now - m_data->syncStart;
+        m_data->addEvent( nullptr, -1, Sync,
+            m_data->syncStart, m_data->frame.phaseTime[ Sync ] );
+    }
+}
+
+void QskFrameProfiler::startRendering()
+{
+    QMutexLocker locker( &m_data->mutex );
+    m_data->renderStart = timestamp();
+}
+
+void QskFrameProfiler::finishRendering()
+{
+    const auto now = timestamp();
+
+    QMutexLocker locker( &m_data->mutex );
+
+    if ( m_data->renderStart >= 0 )
+    {
+        m_data->frame.phaseTime[ Render ] = now - m_data->renderStart;
+        m_data->addEvent( nullptr, -1, Render,
+            m_data->renderStart, m_data->frame.phaseTime[ Render ] );
+    }
+
+    m_data->renderEnd = now;
+}
+
+void QskFrameProfiler::finishFrame()
+{
+    const auto now = timestamp();
+
+    QMutexLocker locker( &m_data->mutex );
+
+    if ( m_data->syncStart < 0 )
+        return; // we have missed the beginning of the frame
+
+    if ( m_data->renderEnd >= 0 )
+    {
+        m_data->frame.phaseTime[ Swap ] = now - m_data->renderEnd;
+        m_data->addEvent( nullptr, -1, Swap,
+            m_data->renderEnd, m_data->frame.phaseTime[ Swap ] );
+    }
+
+    m_data->frames.append( m_data->frame );
+    m_data->syncStart = -1;
+}
+
+QByteArray QskFrameProfiler::chromeTrace() const
+{
+    QVector< Event > events;
+    {
+        QMutexLocker locker( &m_data->mutex );
+        events = m_data->events.toVector();
+    }
+
+    QByteArray trace;
+    trace.reserve( events.size() * 100 + 100 );
+
+    trace += "{\"displayTimeUnit\":\"ms\",\"traceEvents\":[\n";
+    trace += "{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":1,\"tid\":1,"
+        "\"args\":{\"name\":\"GUI\"}},\n";
+    trace += "{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":1,\"tid\":2,"
+        "\"args\":{\"name\":\"Scene Graph\"}}";
+
+    for ( const auto& event : std::as_const( events ) )
+    {
+        QByteArray name;
+        QByteArray category;
+
+        if ( event.className )
+        {
+            name = event.className;
+            if ( event.nodeRole >= 0 )
+                name += "/role " + QByteArray::number( event.nodeRole );
+
+            category = qskPhaseName( event.phase );
+        }
+        else
+        {
+            name = qskPhaseName( event.phase );
+            category = "Frame";
+        }
+
+        // timestamps in microseconds
+        trace += ",\n{\"name\":\"" + name + "\",\"cat\":\"" + category
+            + "\",\"ph\":\"X\",\"ts\":"
+            + QByteArray::number( event.startTime / 1000.0, 'f', 3 )
+            + ",\"dur\":" + QByteArray::number( event.duration / 1000.0, 'f', 3 )
+            + ",\"pid\":1,\"tid\":" + QByteArray::number( qskThreadId( event.phase ) )
+            + "}";
+    }
+
+    trace += "\n]}\n";
+
+    return trace;
+}
+
+bool QskFrameProfiler::writeChromeTrace( QIODevice* device ) const
+{
+    if ( device == nullptr )
+        return false;
+
+    const auto trace = chromeTrace();
+    return device->write( trace ) == trace.size();
+}
+
+bool QskFrameProfiler::writeChromeTrace( const QString& fileName ) const
+{
+    QFile file( fileName );
+    if ( !file.open( QIODevice::WriteOnly | QIODevice::Truncate ) )
+        return false;
+
+    return writeChromeTrace( &file );
+}
+
+#include "moc_QskFrameProfiler.cpp"
@@ -0,0 +1,134 @@
+/******************************************************************************
+ * QSkinny - Copyright (C) The authors
+ *           SPDX-License-Identifier: BSD-3-Clause
+ *****************************************************************************/
+
+#ifndef QSK_FRAME_PROFILER_H
+#define QSK_FRAME_PROFILER_H
+
+#include "QskGlobal.h"
+
+#include <qobject.h>
+#include <qvector.h>
+#include <memory>
+
+class QQuickWindow;
+class QQuickItem;
+class QIODevice;
+
+/*
+    QskFrameProfiler records the time being spent in the phases of
+    the frames of a window: polishing, synchronizing the scene graph,
+    rendering and swapping.
+
+    Time being spent in QskQuickItem::updatePolish/updatePaintNode and in
+    the node roles of QskSkinlet::updateNode is attributed to the class
+    of the item, so that expensive controls can be identified.
+
+    The data is stored in ring buffers, that can be read at runtime
+    or exported in the Chrome trace event format ( chrome://tracing, Perfetto ).
+
+    The profiler is disabled by default and has no cost beyond a
+    single check, as long as no profiler is attached to any window.
+ */
+
+class QSK_EXPORT QskFrameProfiler : public QObject
+{
+    Q_OBJECT
+
+    using Inherited = QObject;
+
+  public:
+    enum Phase
+    {
+        Polish,
+        Sync,
+        Render,
+        Swap,
+
+        PhaseCount
+    };
+
+    class Frame
+    {
+      public:
+        qint64 duration() const;
+
+        quint64 number = 0;
+
+        // nanoseconds relative to the creation of the profiler
+        qint64 timestamp = 0;
+        qint64 phaseTime[ PhaseCount ] = {};
+    };
+
+    class Record
+    {
+      public:
+        const char* className = nullptr;
+
+        // -1: the item itself, otherwise the node role of its skinlet
+        int nodeRole = -1;
+
+        Phase phase = Polish;
+
+        /*
+            Times are exclusive: the time of the node roles
+            is not included in the record of the item.
+         */
+        int count = 0;
+        qint64 time = 0; // nanoseconds
+        qint64 maximum = 0; // nanoseconds
+    };
+
+    QskFrameProfiler( QQuickWindow* );
+    ~QskFrameProfiler() override;
+
+    QQuickWindow* window() const;
+
+    /*
+        Stops recording and unregisters the profiler from its window.
+        As the scene graph thread might still be inside of one of the
+        slots, the profiler must not be deleted before the thread
+        has finished the current frame: s.a QskWindow::setFrameProfilingEnabled
+     */
+    void detach();
+
+    void setFrameCapacity( int );
+    int frameCapacity() const;
+
+    void setEventCapacity( int );
+    int eventCapacity() const;
+
+    // the recorded frames, the oldest first
+    QVector< Frame > frames() const;
+
+    // time and call counts per control class and node role
+    QVector< Record > records() const;
+
+    void reset();
+
+    QByteArray chromeTrace() const;
+    bool writeChromeTrace( QIODevice* ) const;
+    bool writeChromeTrace( const QString& fileName ) const;
+
+    // nanoseconds relative to the creation of the profiler
+    qint64 timestamp() const;
+
+    void addItemTiming( const QQuickItem*, Phase,
+        qint64 startTime, int nodeRole = -1 );
+
+    static QskFrameProfiler* profiler( const QQuickWindow* );
+
+  private:
+    void startPolishing();
+    void startSynchronizing();
+    void finishSynchronizing();
+    void startRendering();
+    void finishRendering();
+    void finishFrame();
+
+    class PrivateData;
+    std::unique_ptr< PrivateData > m_data;
+};
+
+#endif
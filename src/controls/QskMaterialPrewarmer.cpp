@@ -0,0 +1,317 @@
+/******************************************************************************
+ * QSkinny - Copyright (C) The authors
+ *           SPDX-License-Identifier: BSD-3-Clause
+ *****************************************************************************/
+
+#include "QskMaterialPrewarmer.h"
+#include "QskArcShadowNode.h"
+#include "QskBoxShadowNode.h"
+#include "QskBoxShapeMetrics.h"
+#include "QskGradient.h"
+#include "QskLinesNode.h"
+#include "QskShapeNode.h"
+#include "QskStippleMetrics.h"
+
+#include <qelapsedtimer.h>
+#include <qmutex.h>
+#include <qpainterpath.h>
+#include <qpointer.h>
+#include <qquickwindow.h>
+
+QSK_QT_PRIVATE_BEGIN
+#include <private/qquickwindow_p.h>
+#include <private/qsgrenderer_p.h>
+QSK_QT_PRIVATE_END
+
+static QSGNode* qskCreateNode(
+    QskMaterialPrewarmer::Material material, bool translucent )
+{
+    using P = QskMaterialPrewarmer;
+
+    // outside of the window, but not culled by the renderer
+    const QRectF rect( -20.0, translucent ? -40.0 : -20.0, 10.0, 10.0 );
+
+    const int alpha = translucent ? 128 : 255;
+
+    switch ( material )
+    {
+        case P::LinearGradient:
+        case P::RadialGradient:
+        case P::ConicGradient:
+        {
+            QColor c1( Qt::darkGray );
+            c1.setAlpha( alpha );
+
+            QColor c2( Qt::lightGray );
+            c2.setAlpha( alpha );
+
+            QskGradient gradient( c1, c2 );
+
+            if ( material == P::LinearGradient )
+                gradient.setLinearDirection( Qt::Vertical );
+            else if ( material == P::RadialGradient )
+                gradient.setRadialDirection( 0.5, 0.5, 0.5 );
+            else
+                gradient.setConicDirection( 0.5, 0.5 );
+
+            QPainterPath path;
+            path.addRect( rect );
+
+            auto node = new QskShapeNode();
+            node->updateNode( path, QTransform(), rect, gradient );
+
+            return node;
+        }
+        case P::BoxShadow:
+        {
+            auto node = new QskBoxShadowNode();
+            node->setShadowData( rect, QskBoxShapeMetrics( 2.0 ), 4.0,
+                QColor( 0, 0, 0, alpha ) );
+
+            return node;
+        }
+        case P::ArcShadow:
+        {
+            auto node = new QskArcShadowNode();
+            node->setShadowData( rect, 1.0, 4.0, 0.0, 90.0, QColor( 0, 0, 0, alpha ) );
+
+            return node;
+        }
+        case P::CrispLines:
+        case P::DashedLines:
+        {
+            QskStippleMetrics stippleMetrics;
+            if ( material == P::DashedLines )
+                stippleMetrics = QskStippleMetrics( Qt::DashLine );
+
+            auto node = new QskLinesNode();
+            node->updateLine( QColor( 0, 0, 0, alpha ), 1.0, stippleMetrics,
+                QTransform(), rect.topLeft(), rect.bottomRight() );
+
+            return node;
+        }
+        default:
+            return nullptr;
+    }
+}
+
+static QSGNode* qskCreateNode( QskMaterialPrewarmer::Material material )
+{
+    /*
+        Blending is part of the pipeline state, so translucent
+        colors need their own pipelines to be warmed up.
+     */
+
+    auto opaqueNode = qskCreateNode( material, false );
+    if ( opaqueNode == nullptr )
+        return nullptr;
+
+    auto node = new QSGNode();
+    node->appendChildNode( opaqueNode );
+    node->appendChildNode( qskCreateNode( material, true ) );
+
+    return node;
+}
+
+class QskMaterialPrewarmer::PrivateData
+{
+  public:
+    PrivateData( QQuickWindow* window )
+        : window( window )
+    {
+    }
+
+    QPointer< QQuickWindow > window;
+
+    mutable QMutex mutex;
+    QVector< Timing > timings;
+    bool running = false;
+
+    // only accessed from the scene graph thread
+
+    int step = -1; // -1: frame without prewarming
+    qint64 baseline = 0;
+
+    QElapsedTimer timer;
+    QSGNode* node = nullptr;
+};
+
+QskMaterialPrewarmer::QskMaterialPrewarmer( QQuickWindow* window )
+    : Inherited( window )
+    , m_data( new PrivateData( window ) )
+{
+    Q_ASSERT( window );
+}
+
+QskMaterialPrewarmer::~QskMaterialPrewarmer()
+{
+}
+
+QQuickWindow* QskMaterialPrewarmer::window() const
+{
+    return m_data->window;
+}
+
+void QskMaterialPrewarmer::start()
+{
+    auto window = m_data->window.data();
+    if ( window == nullptr || isRunning() )
+        return;
+
+    {
+        QMutexLocker locker( &m_data->mutex );
+
+        m_data->timings.clear();
+        m_data->running = true;
+    }
+
+    m_data->step = -1;
+    m_data->baseline = 0;
+
+    /*
+        The scene graph might run on a different thread and we
+        need direct connections to get the timing right.
+     */
+
+    connect( window, &QQuickWindow::afterSynchronizing,
+        this, [ this ] { updateNode(); }, Qt::DirectConnection );
+
+    connect( window, &QQuickWindow::beforeRendering,
+        this, [ this ] { startRendering(); }, Qt::DirectConnection );
+
+    connect( window, &QQuickWindow::afterRendering,
+        this, [ this ] { finishRendering(); }, Qt::DirectConnection );
+
+    connect( window, &QQuickWindow::sceneGraphInvalidated,
+        this, [ this ] { invalidate(); }, Qt::DirectConnection );
+
+    window->update();
+}
+
+bool QskMaterialPrewarmer::isRunning() const
+{
+    QMutexLocker locker( &m_data->mutex );
+    return m_data->running;
+}
+
+QVector< QskMaterialPrewarmer::Timing > QskMaterialPrewarmer::timings() const
+{
+    QMutexLocker locker( &m_data->mutex );
+    return m_data->timings;
+}
+
+void QskMaterialPrewarmer::updateNode()
+{
+    // scene graph thread, while the GUI thread is blocked
+
+    auto d = QQuickWindowPrivate::get( m_data->window );
+    if ( d->renderer == nullptr )
+        return;
+
+    auto rootNode = d->renderer->rootNode();
+
+    if ( m_data->node )
+    {
+        rootNode->removeChildNode( m_data->node );
+
+        delete m_data->node;
+        m_data->node = nullptr;
+    }
+
+    if ( m_data->step >= MaterialCount )
+    {
+        finish();
+        return;
+    }
+
+    if ( m_data->step >= 0 )
+    {
+        m_data->node = qskCreateNode( static_cast< Material >( m_data->step ) );
+        if ( m_data->node )
+            rootNode->appendChildNode( m_data->node );
+    }
+}
+
+void QskMaterialPrewarmer::startRendering()
+{
+    m_data->timer.start();
+}
+
+void QskMaterialPrewarmer::finishRendering()
+{
+    if ( !m_data->timer.isValid() )
+        return;
+
+    const auto time = m_data->timer.nsecsElapsed();
+    m_data->timer.invalidate();
+
+    if ( m_data->step < 0 )
+    {
+        m_data->baseline = time;
+    }
+    else if ( m_data->step < MaterialCount )
+    {
+        const Timing timing { static_cast< Material >( m_data->step ),
+            qMax( time - m_data->baseline, qint64( 0 ) ) };
+
+        QMutexLocker locker( &m_data->mutex );
+        m_data->timings += timing;
+    }
+
+    m_data->step++;
+
+    // one more frame for creating the next node or removing the last one
+    QMetaObject::invokeMethod( m_data->window, "update", Qt::QueuedConnection );
+}
+
+void QskMaterialPrewarmer::invalidate()
+{
+    // the node has been deleted together with the scene graph
+    m_data->node = nullptr;
+    m_data->timer.invalidate();
+}
+
+void QskMaterialPrewarmer::finish()
+{
+    disconnect( m_data->window, nullptr, this, nullptr );
+
+    {
+        QMutexLocker locker( &m_data->mutex );
+        m_data->running = false;
+    }
+
+    QMetaObject::invokeMethod( this,
+        [ this ] { Q_EMIT finished(); }, Qt::QueuedConnection );
+}
+
+const char* QskMaterialPrewarmer::materialName( Material material )
+{
+    switch ( material )
+    {
+        case LinearGradient:
+            return "gradientlinear";
+
+        case RadialGradient:
+            return "gradientradial";
+
+        case ConicGradient:
+            return "gradientconic";
+
+        case BoxShadow:
+            return "boxshadow";
+
+        case ArcShadow:
+            return "arcshadow";
+
+        case CrispLines:
+            return "crisplines";
+
+        case DashedLines:
+            return "dashedlines";
+
+        default:
+            return nullptr;
+    }
+}
+
+#include "moc_QskMaterialPrewarmer.cpp"
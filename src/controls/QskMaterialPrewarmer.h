@@ -0,0 +1,90 @@
+/******************************************************************************
+ * QSkinny - Copyright (C) The authors
+ *           SPDX-License-Identifier: BSD-3-Clause
+ *****************************************************************************/
+
+#ifndef QSK_MATERIAL_PREWARMER_H
+#define QSK_MATERIAL_PREWARMER_H
+
+#include "QskGlobal.h"
+
+#include <qobject.h>
+#include <qvector.h>
+#include <memory>
+
+class QQuickWindow;
+
+/*
+    The shaders and pipelines of the QSkinny materials are created,
+    when being needed for the first time. This might result in a stuttering
+    animation, f.e when opening a drawer, that displays a shadow.
+
+    QskMaterialPrewarmer inserts a small node for each material into
+    the scene graph of the window - one per frame and outside of the
+    visible area - so that the renderer builds its pipeline in advance.
+    The additional time of each of these frames is recorded
+    compared to a frame without a prewarming node.
+
+    Note, that the pipelines are created for the current render target
+    of the window and might not be reusable for other targets.
+ */
+class QSK_EXPORT QskMaterialPrewarmer : public QObject
+{
+    Q_OBJECT
+
+    using Inherited = QObject;
+
+  public:
+    enum Material
+    {
+        LinearGradient,
+        RadialGradient,
+        ConicGradient,
+
+        BoxShadow,
+        ArcShadow,
+
+        CrispLines,
+        DashedLines,
+
+        MaterialCount
+    };
+    Q_ENUM( Material )
+
+    class Timing
+    {
+      public:
+        Material material = LinearGradient;
+
+        // nanoseconds compared to a frame without a prewarming node
+        qint64 time = 0;
+    };
+
+    QskMaterialPrewarmer( QQuickWindow* );
+    ~QskMaterialPrewarmer() override;
+
+    QQuickWindow* window() const;
+
+    void start();
+    bool isRunning() const;
+
+    QVector< Timing > timings() const;
+
+    static const char* materialName( Material );
+
+  Q_SIGNALS:
+    void finished();
+
+  private:
+    void updateNode();
+    void startRendering();
+    void finishRendering();
+    void invalidate();
+
+    void finish();
+
+    class PrivateData;
+    std::unique_ptr< PrivateData > m_data;
+};
+
+#endif
@@ -0,0 +1,380 @@
+/******************************************************************************
+ * QSkinny - Copyright (C) The authors
+ *           SPDX-License-Identifier: BSD-3-Clause
+ *****************************************************************************/
+
+#include "QskMemoryStatistics.h"
+#include "QskQuick.h"
+#include "QskSkinnable.h"
+#include "QskSkinHintTable.h"
+#include "QskColorRamp.h"
+
+#include "QskArcNode.h"
+#include "QskArcShadowNode.h"
+#include "QskBoxClipNode.h"
+#include "QskBoxFillNode.h"
+#include "QskBoxNode.h"
+#include "QskBoxRectangleNode.h"
+#include "QskBoxShadowNode.h"
+#include "QskGraduationNode.h"
+#include "QskGraphicNode.h"
+#include "QskLinesNode.h"
+#include "QskStrokeNode.h"
+#include "QskTextNode.h"
+#include "QskTreeNode.h"
+
+#include <qdebug.h>
+#include <qquickitem.h>
+#include <qquickwindow.h>
+#include <qsgimagenode.h>
+#include <qsgsimpletexturenode.h>
+
+static const char* qskNodeClassName( const QSGNode* node )
+{
+    /*
+        Checking the more specialized classes first. dynamic_cast is
+        expensive, but collecting the statistics is no hot path.
+     */
+
+    if ( dynamic_cast< const QskArcNode* >( node ) )
+        return "QskArcNode";
+
+    if ( dynamic_cast< const QskShapeNode* >( node ) )
+        return "QskShapeNode";
+
+    if ( dynamic_cast< const QskBoxRectangleNode* >( node ) )
+        return "QskBoxRectangleNode";
+
+    if ( dynamic_cast< const QskBoxFillNode* >( node ) )
+        return "QskBoxFillNode";
+
+    if ( dynamic_cast< const QskStrokeNode* >( node ) )
+        return "QskStrokeNode";
+
+    if ( dynamic_cast< const QskFillNode* >( node ) )
+        return "QskFillNode";
+
+    if ( dynamic_cast< const QskLinesNode* >( node ) )
+        return "QskLinesNode";
+
+    if ( dynamic_cast< const QskGraduationNode* >( node ) )
+        return "QskGraduationNode";
+
+    if ( dynamic_cast< const QskBasicLinesNode* >( node ) )
+        return "QskBasicLinesNode";
+
+    if ( dynamic_cast< const QskBoxShadowNode* >( node ) )
+        return "QskBoxShadowNode";
+
+    if ( dynamic_cast< const QskArcShadowNode* >( node ) )
+        return "QskArcShadowNode";
+
+    if ( dynamic_cast< const QskGraphicNode* >( node ) )
+        return "QskGraphicNode";
+
+    if ( dynamic_cast< const QskPaintedNode* >( node ) )
+        return "QskPaintedNode";
+
+    if ( dynamic_cast< const QskBoxNode* >( node ) )
+        return "QskBoxNode";
+
+    if ( dynamic_cast< const QskBoxClipNode* >( node ) )
+        return "QskBoxClipNode";
+
+    if ( dynamic_cast< const QskTextNode* >( node ) )
+        return "QskTextNode";
+
+    if ( dynamic_cast< const QskItemNode* >( node ) )
+        return "QskItemNode";
+
+    if ( dynamic_cast< const QskTreeNode* >( node ) )
+        return "QskTreeNode";
+
+    if ( dynamic_cast< const QSGImageNode* >( node ) )
+        return "QSGImageNode";
+
+    if ( dynamic_cast< const QSGSimpleTextureNode* >( node ) )
+        return "QSGSimpleTextureNode";
+
+    switch ( node->type() )
+    {
+        case QSGNode::GeometryNodeType:
+            return "QSGGeometryNode";
+
+        case QSGNode::TransformNodeType:
+            return "QSGTransformNode";
+
+        case QSGNode::ClipNodeType:
+            return "QSGClipNode";
+
+        case QSGNode::OpacityNodeType:
+            return "QSGOpacityNode";
+
+        case QSGNode::RootNodeType:
+            return "QSGRootNode";
+
+        case QSGNode::RenderNodeType:
+            return "QSGRenderNode";
+
+        default:
+            return "QSGNode";
+    }
+}
+
+static inline qint64 qskTextureBytes( const QSGTexture* texture )
+{
+    if ( texture == nullptr )
+        return 0;
+
+    // assuming 32 bit per pixel
+    const auto size = texture->textureSize();
+    return qint64( size.width() ) * size.height() * 4;
+}
+
+static inline qint64 qskTextureBytes( const QSGNode* node )
+{
+    if ( auto imageNode = dynamic_cast< const QSGImageNode* >( node ) )
+        return qskTextureBytes( imageNode->texture() );
+
+    if ( auto textureNode = dynamic_cast< const QSGSimpleTextureNode* >( node ) )
+        return qskTextureBytes( textureNode->texture() );
+
+    return 0;
+}
+
+QskMemoryStatistics::NodeStatistics&
+QskMemoryStatistics::NodeStatistics::operator+=( const NodeStatistics& other )
+{
+    count += other.count;
+    vertexBytes += other.vertexBytes;
+    indexBytes += other.indexBytes;
+    textureBytes += other.textureBytes;
+
+    return *this;
+}
+
+QskMemoryStatistics::HintStatistics&
+QskMemoryStatistics::HintStatistics::operator+=( const HintStatistics& other )
+{
+    skinnableCount += other.skinnableCount;
+    hintCount += other.hintCount;
+    bytes += other.bytes;
+
+    return *this;
+}
+
+QskMemoryStatistics::QskMemoryStatistics()
+{
+}
+
+QskMemoryStatistics::QskMemoryStatistics( const QQuickWindow* window )
+{
+    addWindow( window );
+}
+
+QskMemoryStatistics::QskMemoryStatistics( const QQuickItem* item )
+{
+    addItem( item );
+}
+
+void QskMemoryStatistics::reset()
+{
+    m_itemCount = 0;
+    m_nodeStatistics.clear();
+    m_hintStatistics.clear();
+}
+
+void QskMemoryStatistics::addWindow( const QQuickWindow* window )
+{
+    if ( window )
+        addItem( window->contentItem() );
+}
+
+void QskMemoryStatistics::addItem( const QQuickItem* item )
+{
+    if ( item == nullptr )
+        return;
+
+    m_itemCount++;
+
+    if ( const auto itemNode = qskItemNode( item ) )
+    {
+        /*
+            The nodes between the item node and the paint node
+            ( clip, opacity ... ) belong to the item, while the
+            children of the item node are the nodes of the child items.
+         */
+        auto node = qskPaintNode( item );
+        if ( node )
+        {
+            addNodeTree( node );
+
+            for ( node = node->parent(); node && node != itemNode; node = node->parent() )
+                addNode( node );
+        }
+
+        addNode( itemNode );
+    }
+
+    if ( auto skinnable = dynamic_cast< const QskSkinnable* >( item ) )
+    {
+        const auto& table = skinnable->hintTable();
+
+        auto& statistics = m_hintStatistics[ item->metaObject()->className() ];
+
+        statistics.skinnableCount++;
+        statistics.hintCount += table.hintCount();
+        statistics.bytes += hintTableBytes( table );
+    }
+
+    const auto children = item->childItems();
+    for ( const auto child : children )
+        addItem( child );
+}
+
+void QskMemoryStatistics::addNode( const QSGNode* node )
+{
+    auto& statistics = m_nodeStatistics[ qskNodeClassName( node ) ];
+
+    statistics.count++;
+
+    if ( node->type() == QSGNode::GeometryNodeType )
+    {
+        const auto geometryNode = static_cast< const QSGGeometryNode* >( node );
+
+        if ( const auto geometry = geometryNode->geometry() )
+        {
+            statistics.vertexBytes +=
+                qint64( geometry->vertexCount() ) * geometry->sizeOfVertex();
+
+            statistics.indexBytes +=
+                qint64( geometry->indexCount() ) * geometry->sizeOfIndex();
+        }
+
+        statistics.textureBytes += qskTextureBytes( node );
+    }
+}
+
+void QskMemoryStatistics::addNodeTree( const QSGNode* node )
+{
+    addNode( node );
+
+    for ( auto child = node->firstChild();
+        child != nullptr; child = child->nextSibling() )
+    {
+        addNodeTree( child );
+    }
+}
+
+QskMemoryStatistics::NodeStatistics QskMemoryStatistics::totalNodeStatistics() const
+{
+    NodeStatistics total;
+
+    for ( const auto& statistics : m_nodeStatistics )
+        total += statistics;
+
+    return total;
+}
+
+QskMemoryStatistics::HintStatistics QskMemoryStatistics::totalHintStatistics() const
+{
+    HintStatistics total;
+
+    for ( const auto& statistics : m_hintStatistics )
+        total += statistics;
+
+    return total;
+}
+
+int QskMemoryStatistics::colorRampCount()
+{
+    return QskColorRamp::textureCount();
+}
+
+qint64 QskMemoryStatistics::colorRampBytes()
+{
+    return QskColorRamp::textureBytes();
+}
+
+qint64 QskMemoryStatistics::hintTableBytes( const QskSkinHintTable& table )
+{
+    if ( !table.hasHints() )
+        return 0;
+
+    using Entry = QskSkinHintTable::Entry;
+
+    const qint64 count = table.hintCount();
+
+    if ( table.bucketCount() == 0 )
+    {
+        // compact table: one block with all entries
+        return count * sizeof( Entry );
+    }
+
+    /*
+        An estimation for a std::unordered_map with one heap
+        allocation for each entry ( value + next pointer + cached hash )
+        and the array of buckets. The payload of the QVariants
+        is not taken into account.
+     */
+
+    qint64 bytes = sizeof( std::unordered_map< QskAspect, QVariant > );
+    bytes += count * ( sizeof( Entry ) + 2 * sizeof( void* ) );
+    bytes += qint64( table.bucketCount() ) * sizeof( void* );
+
+    return bytes;
+}
+
+void QskMemoryStatistics::dump() const
+{
+    qDebug().noquote() << *this;
+}
+
+#ifndef QT_NO_DEBUG_STREAM
+
+QDebug operator<<( QDebug debug, const QskMemoryStatistics& statistics )
+{
+    QDebugStateSaver saver( debug );
+    debug.nospace();
+
+    debug << "QskMemoryStatistics: " << statistics.itemCount() << " items";
+
+    const auto& nodeStatistics = statistics.nodeStatistics();
+    for ( auto it = nodeStatistics.constBegin(); it != nodeStatistics.constEnd(); ++it )
+    {
+        const auto& s = it.value();
+
+        debug << "\n    " << it.key().constData() << ": " << s.count
+            << ", vertexes: " << s.vertexBytes << "b"
+            << ", indexes: " << s.indexBytes << "b"
+            << ", textures: " << s.textureBytes << "b";
+    }
+
+    const auto nodes = statistics.totalNodeStatistics();
+
+    debug << "\n  Nodes: " << nodes.count
+        << ", vertexes: " << nodes.vertexBytes << "b"
+        << ", indexes: " << nodes.indexBytes << "b"
+        << ", textures: " << nodes.textureBytes << "b";
+
+    const auto& hintStatistics = statistics.hintStatistics();
+    for ( auto it = hintStatistics.constBegin(); it != hintStatistics.constEnd(); ++it )
+    {
+        const auto& s = it.value();
+
+        debug << "\n    " << it.key().constData() << ": " << s.skinnableCount
+            << ", hints: " << s.hintCount << ", " << s.bytes << "b";
+    }
+
+    const auto hints = statistics.totalHintStatistics();
+
+    debug << "\n  Local hints: " << hints.hintCount
+        << " in " << hints.skinnableCount << " skinnables, " << hints.bytes << "b";
+
+    debug << "\n  Color ramps: " << QskMemoryStatistics::colorRampCount()
+        << ", " << QskMemoryStatistics::colorRampBytes() << "b";
+
+    return debug;
+}
+
+#endif
@@ -0,0 +1,120 @@
+/******************************************************************************
+ * QSkinny - Copyright (C) The authors
+ *           SPDX-License-Identifier: BSD-3-Clause
+ *****************************************************************************/
+
+#ifndef QSK_MEMORY_STATISTICS_H
+#define QSK_MEMORY_STATISTICS_H
+
+#include "QskGlobal.h"
+
+#include <qbytearray.h>
+#include <qmap.h>
+
+class QskSkinHintTable;
+class QQuickItem;
+class QQuickWindow;
+class QSGNode;
+class QDebug;
+
+/*
+    QskMemoryStatistics collects the scene graph nodes, geometries,
+    textures and local skin hints of a window or of a subtree of items.
+
+    While QskObjectCounter tracks the creation/destruction of QObjects,
+    QskMemoryStatistics is a snapshot of the resources being in use
+    at the moment of its collection.
+
+    The nodes are inspected without synchronizing with the scene graph thread.
+    So the statistics should be collected, when the scene graph is idle
+    or from a slot connected to QQuickWindow::afterSynchronizing
+    using a direct connection.
+ */
+class QSK_EXPORT QskMemoryStatistics
+{
+  public:
+    class NodeStatistics
+    {
+      public:
+        NodeStatistics& operator+=( const NodeStatistics& );
+
+        int count = 0;
+
+        qint64 vertexBytes = 0;
+        qint64 indexBytes = 0;
+        qint64 textureBytes = 0;
+    };
+
+    class HintStatistics
+    {
+      public:
+        HintStatistics& operator+=( const HintStatistics& );
+
+        int skinnableCount = 0;
+        int hintCount = 0;
+
+        // an estimation of the heap memory used by the hint tables
+        qint64 bytes = 0;
+    };
+
+    QskMemoryStatistics();
+    QskMemoryStatistics( const QQuickWindow* );
+    QskMemoryStatistics( const QQuickItem* );
+
+    void reset();
+
+    void addWindow( const QQuickWindow* );
+    void addItem( const QQuickItem* ); // including all children
+
+    int itemCount() const;
+
+    // per node class: "QskBoxRectangleNode", "QskTextNode", "QSGGeometryNode" ...
+    const QMap< QByteArray, NodeStatistics >& nodeStatistics() const;
+    NodeStatistics totalNodeStatistics() const;
+
+    // local hint tables per control class
+    const QMap< QByteArray, HintStatistics >& hintStatistics() const;
+    HintStatistics totalHintStatistics() const;
+
+    // shared color tables of the gradient materials
+    static int colorRampCount();
+    static qint64 colorRampBytes();
+
+    static qint64 hintTableBytes( const QskSkinHintTable& );
+
+    void dump() const;
+
+  private:
+    void addNode( const QSGNode* );
+    void addNodeTree( const QSGNode* );
+
+    int m_itemCount = 0;
+
+    QMap< QByteArray, NodeStatistics > m_nodeStatistics;
+    QMap< QByteArray, HintStatistics > m_hintStatistics;
+};
+
+inline int QskMemoryStatistics::itemCount() const
+{
+    return m_itemCount;
+}
+
+inline const QMap< QByteArray, QskMemoryStatistics::NodeStatistics >&
+QskMemoryStatistics::nodeStatistics() const
+{
+    return m_nodeStatistics;
+}
+
+inline const QMap< QByteArray, QskMemoryStatistics::HintStatistics >&
+QskMemoryStatistics::hintStatistics() const
+{
+    return m_hintStatistics;
+}
+
+#ifndef QT_NO_DEBUG_STREAM
+
+QSK_EXPORT QDebug operator<<( QDebug, const QskMemoryStatistics& );
+
+#endif
+
+#endif
@@ -41,6 +41,30 @@ static inline int qskActionIndex( const QVector< int >& actions, int index )
     return it - actions.constBegin();
 }
 
+static void qskSetHoverPosition( QskMenu* menu, const QPointF& pos )
+{
+    const auto aspect = QskMenu::Segment | QskMenu::Hovered
+        | QskAspect::Metric | QskAspect::Position;
+
+    const auto oldPos = menu->effectiveSkinHint( aspect ).toPointF();
+
+    // see QskMenuSkinlet::sampleStates
+    const int oldIndex = oldPos.isNull() ? -1 : menu->indexAtPosition( oldPos );
+    const int newIndex = pos.isNull() ? -1 : menu->indexAtPosition( pos );
+
+    menu->setSkinHint( aspect, pos );
+
+    if ( oldIndex < 0 && newIndex < 0 )
+    {
+        menu->update();
+        return;
+    }
+
+    // only the samples, that gain/lose the Hovered state
+    menu->setSampleDirty( oldIndex );
+    menu->setSampleDirty( newIndex );
+}
+
 class QskMenu::PrivateData
 {
   public:
@@ -207,7 +231,7 @@ void QskMenu::setOptions( const QVector< QskLabelData >& options )
     }
 
     resetImplicitSize();
-    update();
+    setAllSamplesDirty();
 
     if ( isComponentComplete() )
         Q_EMIT optionsChanged();
@@ -264,6 +288,12 @@ void QskMenu::setCurrentIndex( int index )
     {
         setPositionHint( Cursor, index );
 
+        const auto& actions = m_data->actions;
+
+        // the samples, that gain/lose the Selected state
+        setSampleDirty( qskActionIndex( actions, m_data->currentIndex ) );
+        setSampleDirty( qskActionIndex( actions, index ) );
+
         m_data->currentIndex = index;
         update();
 
@@ -378,26 +408,17 @@ void QskMenu::keyReleaseEvent( QKeyEvent* )
 
 void QskMenu::hoverEnterEvent( QHoverEvent* event )
 {
-    using A = QskAspect;
-
-    setSkinHint( Segment | Hovered | A::Metric | A::Position, qskHoverPosition( event ) );
-    update();
+    qskSetHoverPosition( this, qskHoverPosition( event ) );
 }
 
 void QskMenu::hoverMoveEvent( QHoverEvent* event )
 {
-    using A = QskAspect;
-
-    setSkinHint( Segment | Hovered | A::Metric | A::Position, qskHoverPosition( event ) );
-    update();
+    qskSetHoverPosition( this, qskHoverPosition( event ) );
 }
 
 void QskMenu::hoverLeaveEvent( QHoverEvent* )
 {
-    using A = QskAspect;
-
-    setSkinHint( Segment | Hovered | A::Metric | A::Position, QPointF() );
-    update();
+    qskSetHoverPosition( this, QPointF() );
 }
 
 #ifndef QT_NO_WHEELEVENT
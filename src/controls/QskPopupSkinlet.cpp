@@ -31,6 +31,21 @@ QRectF QskPopupSkinlet::subControlRect( const QskSkinnable* skinnable,
     return Inherited::subControlRect( skinnable, contentsRect, subControl );
 }
 
+QRectF QskPopupSkinlet::opaqueRect( const QskSkinnable* skinnable ) const
+{
+    const auto popup = static_cast< const QskPopup* >( skinnable );
+
+    // while fading the overlay is translucent
+    if ( popup->fadingFactor() >= 1.0 )
+    {
+        const auto rect = opaqueBoxRect( popup, QskPopup::Overlay );
+        if ( !rect.isEmpty() )
+            return rect;
+    }
+
+    return Inherited::opaqueRect( skinnable );
+}
+
 QSGNode* QskPopupSkinlet::updateSubNode(
     const QskSkinnable* skinnable, quint8 nodeRole, QSGNode* node ) const
 {
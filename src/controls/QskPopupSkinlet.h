@@ -29,6 +29,8 @@ class QSK_EXPORT QskPopupSkinlet : public QskSkinlet
     QRectF subControlRect( const QskSkinnable*,
         const QRectF&, QskAspect::Subcontrol ) const override;
 
+    QRectF opaqueRect( const QskSkinnable* ) const override;
+
   protected:
     QSGNode* updateSubNode( const QskSkinnable*,
         quint8 nodeRole, QSGNode* ) const override;
@@ -50,7 +50,14 @@ namespace
 QskPushButtonSkinlet::QskPushButtonSkinlet( QskSkin* skin )
     : Inherited( skin )
 {
+    using Q = QskPushButton;
+
     setNodeRoles( { PanelRole, SplashRole, IconRole, TextRole } );
+
+    // SplashRole: depends on the position of the last press, always updated
+    setNodeRoleDependencies( PanelRole, { Q::Panel } );
+    setNodeRoleDependencies( IconRole, { Q::Icon } );
+    setNodeRoleDependencies( TextRole, { Q::Text } );
 }
 
 QskPushButtonSkinlet::~QskPushButtonSkinlet() = default;
@@ -81,6 +88,26 @@ QRectF QskPushButtonSkinlet::subControlRect( const QskSkinnable* skinnable,
     return Inherited::subControlRect( skinnable, contentsRect, subControl );
 }
 
+QskHashValue QskPushButtonSkinlet::nodeHash( const QskSkinnable* skinnable,
+    quint8 nodeRole, QskHashValue seed ) const
+{
+    const auto button = static_cast< const QskPushButton* >( skinnable );
+
+    switch ( nodeRole )
+    {
+        case TextRole:
+        {
+            const auto hash = qHash( button->text(), seed );
+            return qHash( button->clip(), hash );
+        }
+
+        case IconRole:
+            return button->icon().hash( seed );
+    }
+
+    return Inherited::nodeHash( skinnable, nodeRole, seed );
+}
+
 QSGNode* QskPushButtonSkinlet::updateSubNode(
     const QskSkinnable* skinnable, quint8 nodeRole, QSGNode* node ) const
 {
@@ -37,6 +37,9 @@ class QSK_EXPORT QskPushButtonSkinlet : public QskSkinlet
         Qt::SizeHint, const QSizeF& ) const override;
 
   protected:
+    QskHashValue nodeHash( const QskSkinnable*,
+        quint8 nodeRole, QskHashValue seed ) const override;
+
     QSGNode* updateSubNode( const QskSkinnable*,
         quint8 nodeRole, QSGNode* ) const override;
 
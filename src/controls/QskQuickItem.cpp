@@ -10,6 +10,7 @@
 #include "QskSetup.h"
 #include "QskSkin.h"
 #include "QskDirtyItemFilter.h"
+#include "QskFrameProfiler.h"
 
 #include <qglobalstatic.h>
 #include <qquickwindow.h>
@@ -49,13 +50,17 @@ static inline void qskApplyUpdateFlags(
     d->applyUpdateFlags( flags );
 }
 
-static inline void qskFilterWindow( QQuickWindow* window )
+static inline void qskFilterWindow(
+    QQuickWindow* window, bool occlusionCulling = false )
 {
     if ( window == nullptr )
         return;
 
     static QskDirtyItemFilter itemFilter;
     itemFilter.addWindow( window );
+
+    if ( occlusionCulling )
+        itemFilter.setOcclusionCulling( window, true );
 }
 
 namespace
@@ -73,7 +78,7 @@ namespace
                 qskSetup, [ this ] { updateControlFlags(); } );
 
             /*
-                We would also need to send QEvent::StyleChange, when
+                We would also need to invalidate the skin, when
                 a window has a new skin. TODO ...
              */
             QObject::connect( qskSetup, &QskSetup::skinChanged,
@@ -100,13 +105,19 @@ namespace
 
         void updateSkin()
         {
-            QEvent event( QEvent::StyleChange );
-
+            /*
+                The previous skin is deleted, when we return. So we need
+                to release any references to it now, while QEvent::StyleChange
+                is delivered, when the items are polished the next time.
+             */
             for ( auto item : m_items )
             {
-                event.setAccepted( true );
-                QCoreApplication::sendEvent( item, &event );
+                auto d = static_cast< QskQuickItemPrivate* >(
+                    QskQuickItemPrivate::get( item ) );
+                d->releaseSkin();
             }
+
+            QskQuickItemPrivate::invalidateSkin();
         }
 
       private:
@@ -168,8 +179,8 @@ QskQuickItem::QskQuickItem( QskQuickItemPrivate& dd, QQuickItem* parent )
 {
     setFlag( QQuickItem::ItemHasContents, true );
 
-    if ( dd.updateFlags & QskQuickItem::DeferredUpdate )
-        qskFilterWindow( window() );
+    if ( dd.updateFlags & ( QskQuickItem::DeferredUpdate | QskQuickItem::OcclusionCulling ) )
+        qskFilterWindow( window(), dd.updateFlags & QskQuickItem::OcclusionCulling );
 
     qskRegistry->insert( this );
 }
@@ -434,6 +445,11 @@ bool QskQuickItem::isInitiallyPainted() const
     return d_func()->initiallyPainted;
 }
 
+bool QskQuickItem::isOccluded() const
+{
+    return d_func()->occluded;
+}
+
 bool QskQuickItem::maybeUnresized() const
 {
     Q_D( const QskQuickItem );
@@ -560,6 +576,21 @@ void QskQuickItem::applyUpdateFlag( UpdateFlag flag, bool on )
 
             break;
         }
+        case QskQuickItem::OcclusionCulling:
+        {
+            if ( on )
+            {
+                qskFilterWindow( window(), true );
+            }
+            else
+            {
+                // the next scene graph update will reset the occlusion
+                if ( d->occluded )
+                    update();
+            }
+
+            break;
+        }
         case QskQuickItem::DebugForceBackground:
         {
             // no need to mark it dirty
@@ -712,11 +743,25 @@ void QskQuickItem::itemChange( QQuickItem::ItemChange change,
     {
         case QQuickItem::ItemSceneChange:
         {
-            if ( changeData.window )
             {
-                Q_D( const QskQuickItem );
-                if ( d->updateFlags & QskQuickItem::DeferredUpdate )
-                    qskFilterWindow( changeData.window );
+                Q_D( QskQuickItem );
+
+                // the nodes are recreated for the new window
+                d->occluded = false;
+
+                if ( changeData.window )
+                {
+                    const auto flags = d->updateFlags;
+
+                    if ( flags & ( QskQuickItem::DeferredUpdate | QskQuickItem::OcclusionCulling ) )
+                    {
+                        qskFilterWindow( changeData.window,
+                            flags & QskQuickItem::OcclusionCulling );
+                    }
+
+                    if ( d->isSkinOutdated() )
+                        polish();
+                }
             }
 
 #if 1
@@ -796,7 +841,7 @@ void QskQuickItem::itemChange( QQuickItem::ItemChange change,
 #endif
             if ( changeData.boolValue )
             {
-                if ( d->blockedPolish )
+                if ( d->blockedPolish || d->isSkinOutdated() )
                     polish();
 
                 if ( d->updateFlags & QskQuickItem::DeferredUpdate )
@@ -907,7 +952,7 @@ void QskQuickItem::updatePolish()
 
     if ( d->updateFlags & QskQuickItem::DeferredPolish )
     {
-        if ( !isVisible() )
+        if ( !isVisible() || QskQuickItemPrivate::isViewportCulled( this ) )
         {
             d->blockedPolish = true;
             return;
@@ -916,6 +961,9 @@ void QskQuickItem::updatePolish()
 
     d->blockedPolish = false;
 
+    // delivering a pending QEvent::StyleChange
+    d->updateSkinEpoch();
+
     if ( !d->initiallyPainted )
     {
         /*
@@ -926,7 +974,16 @@ void QskQuickItem::updatePolish()
         aboutToShow();
     }
 
-    updateItemPolish();
+    if ( auto profiler = QskFrameProfiler::profiler( window() ) )
+    {
+        const auto startTime = profiler->timestamp();
+        updateItemPolish();
+        profiler->addItemTiming( this, QskFrameProfiler::Polish, startTime );
+    }
+    else
+    {
+        updateItemPolish();
+    }
 }
 
 void QskQuickItem::aboutToShow()
@@ -955,6 +1012,15 @@ QSGNode* QskQuickItem::updatePaintNode( QSGNode* node, UpdatePaintNodeData* data
         d->clearPreviousNodes = false;
     }
 
+    if ( auto profiler = QskFrameProfiler::profiler( window() ) )
+    {
+        const auto startTime = profiler->timestamp();
+        node = updateItemPaintNode( node );
+        profiler->addItemTiming( this, QskFrameProfiler::Sync, startTime );
+
+        return node;
+    }
+
     return updateItemPaintNode( node );
 }
 
@@ -44,7 +44,12 @@ class QSK_EXPORT QskQuickItem : public QQuickItem
 
         PreferRasterForTextures =  1 << 4,
 
-        DebugForceBackground    =  1 << 7
+        OcclusionCulling        =  1 << 5,
+        PreferVectorForGraphics =  1 << 6,
+
+        DebugForceBackground    =  1 << 7,
+
+        PreferGeometryForShadows = 1 << 8
     };
 
     Q_ENUM( UpdateFlag )
@@ -97,6 +102,9 @@ class QSK_EXPORT QskQuickItem : public QQuickItem
     bool isUpdateNodeScheduled() const;
     bool isInitiallyPainted() const;
 
+    // covered by opaque items, see OcclusionCulling
+    bool isOccluded() const;
+
     bool maybeUnresized() const;
 
   Q_SIGNALS:
@@ -7,6 +7,37 @@
 #include "QskTreeNode.h"
 #include "QskSetup.h"
 
+#include <qglobalstatic.h>
+#include <qguiapplication.h>
+#include <qhash.h>
+#include <qquickwindow.h>
+
+// the number of items culled by a viewport
+static int qskViewportCulledCount = 0;
+
+namespace
+{
+    class SkinEpochs
+    {
+      public:
+        inline quint32 epoch( const QQuickWindow* window ) const
+        {
+            if ( window == nullptr || windows.isEmpty() )
+                return global;
+
+            return qMax( global, windows.value( window, 0 ) );
+        }
+
+        quint32 counter = 0;
+        quint32 global = 0;
+
+        // windows, that have been invalidated on their own
+        QHash< const QQuickWindow*, quint32 > windows;
+    };
+}
+
+Q_GLOBAL_STATIC( SkinEpochs, qskSkinEpochs )
+
 static inline void qskSendEventTo( QObject* object, QEvent::Type type )
 {
     QEvent event( type );
@@ -16,11 +47,14 @@ static inline void qskSendEventTo( QObject* object, QEvent::Type type )
 QskQuickItemPrivate::QskQuickItemPrivate()
     : updateFlags( qskSetup->itemUpdateFlags() )
     , updateFlagsMask( 0 )
+    , skinEpoch( qskSkinEpochs->global )
     , polishOnResize( false )
     , blockedPolish( false )
     , blockedImplicitSize( true )
     , clearPreviousNodes( false )
     , initiallyPainted( false )
+    , occluded( false )
+    , viewportCulled( false )
 {
     if ( updateFlags & QskQuickItem::DeferredLayout )
     {
@@ -49,6 +83,8 @@ QskQuickItemPrivate::QskQuickItemPrivate()
 
 QskQuickItemPrivate::~QskQuickItemPrivate()
 {
+    if ( viewportCulled )
+        qskViewportCulledCount--;
 }
 
 void QskQuickItemPrivate::mirrorChange()
@@ -70,8 +106,8 @@ void QskQuickItemPrivate::applyUpdateFlags( QskQuickItem::UpdateFlags flags )
 
     Q_Q( QskQuickItem );
 
-    Q_STATIC_ASSERT( sizeof( updateFlags ) == 1 );
-    for ( uint i = 0; i < 8; i++ )
+    Q_STATIC_ASSERT( sizeof( updateFlags ) == 2 );
+    for ( uint i = 0; i < 16; i++ )
     {
         const auto flag = static_cast< QskQuickItem::UpdateFlag >( 1 << i );
 
@@ -94,6 +130,103 @@ void QskQuickItemPrivate::implicitSizeChanged()
     layoutConstraintChanged();
 }
 
+void QskQuickItemPrivate::releaseSkin()
+{
+    /*
+        The nodes have been created by the skinlets of the previous skin
+        and must not be passed to the skinlets of the new one - even when
+        the item is updated before being polished.
+     */
+    clearPreviousNodes = true;
+
+    /*
+        The size hints are reset, when QEvent::StyleChange is delivered
+        while polishing: no need to do it twice.
+     */
+}
+
+static void qskPolishOutdated( QQuickItem* item )
+{
+    if ( auto qskItem = qobject_cast< QskQuickItem* >( item ) )
+    {
+        /*
+            Qt polishes the items in reverse order of the requests. So
+            requesting the parents first, the children are updated before
+            them and each layout box gets invalidated by its children
+            while its own polishing is still pending. Then it recalculates
+            its layout only once.
+
+            Hidden items catch up, when becoming visible.
+         */
+        if ( qskItem->isVisible() )
+            qskItem->polish();
+    }
+    else
+    {
+        // other items do not know about skin epochs
+        qskSendEventTo( item, QEvent::StyleChange );
+    }
+
+    const auto children = item->childItems();
+    for ( auto child : children )
+        qskPolishOutdated( child );
+}
+
+void QskQuickItemPrivate::invalidateSkin( QQuickWindow* window )
+{
+    auto epochs = qskSkinEpochs();
+    const auto epoch = ++epochs->counter;
+
+    if ( window )
+    {
+        if ( !epochs->windows.contains( window ) )
+        {
+            QObject::connect( window, &QObject::destroyed,
+                [ window ]() { qskSkinEpochs->windows.remove( window ); } );
+        }
+
+        epochs->windows.insert( window, epoch );
+        qskPolishOutdated( window->contentItem() );
+    }
+    else
+    {
+        epochs->global = epoch;
+
+        const auto windows = QGuiApplication::topLevelWindows();
+        for ( auto w : windows )
+        {
+            if ( auto quickWindow = qobject_cast< QQuickWindow* >( w ) )
+                qskPolishOutdated( quickWindow->contentItem() );
+        }
+    }
+}
+
+bool QskQuickItemPrivate::isSkinOutdated() const
+{
+    return skinEpoch != qskSkinEpochs->epoch( window );
+}
+
+void QskQuickItemPrivate::updateSkinEpoch()
+{
+    const auto epoch = qskSkinEpochs->epoch( window );
+    if ( skinEpoch == epoch )
+        return;
+
+    skinEpoch = epoch;
+
+    /*
+        We are called from updatePolish, when polishScheduled has
+        already been reset. Pretending to be scheduled avoids, that
+        the event handlers put the item into the polish list again.
+     */
+    const bool scheduled = polishScheduled;
+    polishScheduled = true;
+
+    qskSendEventTo( q_func(), QEvent::StyleChange );
+
+    polishScheduled = scheduled;
+}
+
 qreal QskQuickItemPrivate::getImplicitWidth() const
 {
     if ( blockedImplicitSize )
@@ -195,6 +328,93 @@ void QskQuickItemPrivate::implicitHeightChanged()
     implicitSizeChanged();
 }
 
+void QskQuickItemPrivate::setOccluded( bool on )
+{
+    if ( on == occluded )
+        return;
+
+    occluded = on;
+
+    // not rendering the content, while being hidden
+    qskTryBlockNode( paintNode, on );
+
+    if ( !on && dirtyAttributes )
+    {
+        /*
+            The item has been removed from the dirty list, while being
+            occluded. As we are called before QQuickWindow processes
+            the dirty list, it will be updated in the current frame.
+         */
+        addToDirtyList();
+    }
+}
+
+void QskQuickItemPrivate::setViewportCulled( bool on )
+{
+    if ( on == viewportCulled )
+        return;
+
+    viewportCulled = on;
+    qskViewportCulledCount += on ? 1 : -1;
+
+    // hiding the subtree of the item node
+    setCulled( on );
+
+    if ( !on )
+        restoreCulled( q_func() );
+}
+
+bool QskQuickItemPrivate::isViewportCulled( const QQuickItem* item )
+{
+    if ( qskViewportCulledCount == 0 )
+        return false;
+
+    for ( ; item != nullptr; item = item->parentItem() )
+    {
+        if ( auto qskItem = qobject_cast< const QskQuickItem* >( item ) )
+        {
+            auto d = static_cast< const QskQuickItemPrivate* >(
+                QQuickItemPrivate::get( qskItem ) );
+
+            if ( d->viewportCulled )
+                return true;
+        }
+    }
+
+    return false;
+}
+
+void QskQuickItemPrivate::restoreCulled( QQuickItem* item )
+{
+    auto d = QQuickItemPrivate::get( item );
+
+    if ( auto qskItem = qobject_cast< QskQuickItem* >( item ) )
+    {
+        auto dd = static_cast< QskQuickItemPrivate* >( d );
+
+        if ( dd->viewportCulled )
+            return; // culled on its own
+
+        /*
+            Polishing has been blocked, while being culled. As we are
+            called from the polish cycle the item will be polished
+            in the current frame.
+         */
+        if ( dd->blockedPolish )
+            qskItem->polish();
+    }
+
+    if ( d->dirtyAttributes && d->window )
+    {
+        // the item has been removed from the dirty list, while being culled
+        d->addToDirtyList();
+    }
+
+    const auto children = item->childItems();
+    for ( auto child : children )
+        restoreCulled( child );
+}
+
 void QskQuickItemPrivate::cleanupNodes()
 {
     if ( itemNodeInstance == nullptr )
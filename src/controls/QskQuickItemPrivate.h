@@ -25,12 +25,36 @@ class QskQuickItemPrivate : public QQuickItemPrivate
     void applyUpdateFlags( QskQuickItem::UpdateFlags );
     QSGTransformNode* createTransformNode() override;
 
+    // called from QskDirtyItemFilter, when synchronizing the scene graph
+    void setOccluded( bool );
+
+    // called from QskScrollArea for children outside of the viewport
+    void setViewportCulled( bool );
+
+    // the item or one of its ancestors is outside of a viewport
+    static bool isViewportCulled( const QQuickItem* );
+
+    /*
+        Increments the skin epoch of window - or of all windows.
+        QEvent::StyleChange is not sent immediately: outdated items
+        receive it, when being polished the next time.
+     */
+    static void invalidateSkin( QQuickWindow* = nullptr );
+
+    // the skin is about to be replaced
+    virtual void releaseSkin();
+
   protected:
     virtual void layoutConstraintChanged();
     virtual void implicitSizeChanged();
 
   private:
     void cleanupNodes();
+    void restoreCulled( QQuickItem* );
+
+    bool isSkinOutdated() const;
+    void updateSkinEpoch();
+
     void mirrorChange() override;
 
     qreal getImplicitWidth() const override final;
@@ -47,8 +71,10 @@ class QskQuickItemPrivate : public QQuickItemPrivate
   private:
     Q_DECLARE_PUBLIC( QskQuickItem )
 
-    quint8 updateFlags;
-    quint8 updateFlagsMask;
+    quint16 updateFlags;
+    quint16 updateFlagsMask;
+
+    quint32 skinEpoch;
 
     bool polishOnResize : 1;
 
@@ -57,6 +83,8 @@ class QskQuickItemPrivate : public QQuickItemPrivate
     bool clearPreviousNodes : 1;
 
     bool initiallyPainted : 1;
+    bool occluded : 1;
+    bool viewportCulled : 1;
 };
 
 #endif
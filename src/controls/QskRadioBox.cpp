@@ -127,6 +127,7 @@ void QskRadioBox::setOptions( const QStringList& options )
         return;
 
     m_data->options = options;
+    setAllSamplesDirty();
 
     Q_EMIT optionsChanged( options );
     setSelectedIndex( m_data->selectedIndex );
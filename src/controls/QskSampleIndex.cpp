@@ -0,0 +1,218 @@
+/******************************************************************************
+ * QSkinny - Copyright (C) The authors
+ *           SPDX-License-Identifier: BSD-3-Clause
+ *****************************************************************************/
+
+#include "QskSampleIndex.h"
+
+#include <algorithm>
+#include <cmath>
+
+static inline bool qskIsNull( const QRectF& rect )
+{
+    // QRectF::contains never succeeds for them
+    return ( rect.width() == 0.0 ) || ( rect.height() == 0.0 );
+}
+
+static inline qreal qskStart( const QRectF& rect, Qt::Orientation orientation )
+{
+    return ( orientation == Qt::Horizontal ) ? rect.left() : rect.top();
+}
+
+static inline qreal qskEnd( const QRectF& rect, Qt::Orientation orientation )
+{
+    return ( orientation == Qt::Horizontal ) ? rect.right() : rect.bottom();
+}
+
+static bool qskSortIntervals( const QVector< QRectF >& rects,
+    Qt::Orientation orientation, QVector< int >& indexes )
+{
+    std::stable_sort( indexes.begin(), indexes.end(),
+        [ & ]( int i1, int i2 )
+        {
+            return qskStart( rects[i1], orientation ) < qskStart( rects[i2], orientation );
+        } );
+
+    for ( int i = 1; i < indexes.count(); i++ )
+    {
+        const auto& r1 = rects[ indexes[i - 1] ];
+        const auto& r2 = rects[ indexes[i] ];
+
+        if ( qskEnd( r1, orientation ) > qskStart( r2, orientation ) )
+            return false; // overlapping
+    }
+
+    return true;
+}
+
+void QskSampleIndex::setRects( const QVector< QRectF >& rects )
+{
+    clear();
+
+    m_rects.reserve( rects.count() );
+
+    for ( int i = 0; i < rects.count(); i++ )
+    {
+        const auto rect = rects[i].normalized();
+        m_rects += rect;
+
+        if ( !qskIsNull( rect ) )
+        {
+            m_indexes += i;
+            m_boundingRect |= rect;
+        }
+    }
+
+    if ( m_indexes.isEmpty() )
+        return;
+
+    // menus, radio boxes, bars ...
+
+    for ( const auto orientation : { Qt::Vertical, Qt::Horizontal } )
+    {
+        if ( qskSortIntervals( m_rects, orientation, m_indexes ) )
+        {
+            m_mode = Intervals;
+            m_orientation = orientation;
+
+            return;
+        }
+    }
+
+    // a grid, with roughly one sample per cell
+
+    m_mode = Grid;
+
+    const auto count = m_indexes.count();
+
+    const auto aspectRatio = m_boundingRect.width() / m_boundingRect.height();
+
+    m_columns = qBound( 1, qRound( std::sqrt( count * aspectRatio ) ), count );
+    m_rows = qBound( 1, ( count + m_columns - 1 ) / m_columns, count );
+
+    const auto cellWidth = m_boundingRect.width() / m_columns;
+    const auto cellHeight = m_boundingRect.height() / m_rows;
+
+    const auto cellCount = m_columns * m_rows;
+
+    QVector< QVector< int > > cells( cellCount );
+
+    std::sort( m_indexes.begin(), m_indexes.end() );
+
+    for ( const auto index : std::as_const( m_indexes ) )
+    {
+        const auto& r = m_rects[ index ];
+
+        const auto x = r.left() - m_boundingRect.left();
+        const auto y = r.top() - m_boundingRect.top();
+
+        const int col1 = qBound( 0, int( x / cellWidth ), m_columns - 1 );
+        const int col2 = qBound( 0, int( ( x + r.width() ) / cellWidth ), m_columns - 1 );
+        const int row1 = qBound( 0, int( y / cellHeight ), m_rows - 1 );
+        const int row2 = qBound( 0, int( ( y + r.height() ) / cellHeight ), m_rows - 1 );
+
+        for ( int row = row1; row <= row2; row++ )
+        {
+            for ( int col = col1; col <= col2; col++ )
+                cells[ row * m_columns + col ] += index;
+        }
+    }
+
+    // flattening the cells
+
+    m_indexes.clear();
+    m_cellOffsets.reserve( cellCount + 1 );
+
+    for ( const auto& cell : std::as_const( cells ) )
+    {
+        m_cellOffsets += m_indexes.count();
+        m_indexes += cell;
+    }
+
+    m_cellOffsets += m_indexes.count();
+}
+
+void QskSampleIndex::clear()
+{
+    m_rects.clear();
+    m_indexes.clear();
+    m_cellOffsets.clear();
+
+    m_boundingRect = QRectF();
+    m_columns = m_rows = 0;
+
+    m_mode = Intervals;
+    m_orientation = Qt::Vertical;
+}
+
+int QskSampleIndex::indexAt( const QPointF& pos ) const
+{
+    if ( m_indexes.isEmpty() || !m_boundingRect.contains( pos ) )
+        return -1;
+
+    if ( m_mode == Intervals )
+        return intervalIndexAt( pos );
+
+    return gridIndexAt( pos );
+}
+
+int QskSampleIndex::intervalIndexAt( const QPointF& pos ) const
+{
+    const auto orientation = m_orientation;
+    const auto value = ( orientation == Qt::Horizontal ) ? pos.x() : pos.y();
+
+    // the first interval, that does not end before value
+    auto it = std::lower_bound( m_indexes.constBegin(), m_indexes.constEnd(), value,
+        [ this, orientation ]( int index, qreal v )
+        {
+            return qskEnd( m_rects[ index ], orientation ) < v;
+        } );
+
+    /*
+        Adjacent intervals might share a border, where QRectF::contains
+        succeeds for both of them. Like a linear search we want to find
+        the lower index then.
+     */
+    int foundIndex = -1;
+
+    for ( ; it != m_indexes.constEnd(); ++it )
+    {
+        const auto& rect = m_rects[ *it ];
+
+        if ( qskStart( rect, orientation ) > value )
+            break;
+
+        if ( rect.contains( pos ) )
+        {
+            if ( foundIndex < 0 || *it < foundIndex )
+                foundIndex = *it;
+        }
+    }
+
+    return foundIndex;
+}
+
+int QskSampleIndex::gridIndexAt( const QPointF& pos ) const
+{
+    const auto x = pos.x() - m_boundingRect.left();
+    const auto y = pos.y() - m_boundingRect.top();
+
+    // the same calculations as in setRects to avoid rounding issues
+    const auto cellWidth = m_boundingRect.width() / m_columns;
+    const auto cellHeight = m_boundingRect.height() / m_rows;
+
+    const int col = qBound( 0, int( x / cellWidth ), m_columns - 1 );
+    const int row = qBound( 0, int( y / cellHeight ), m_rows - 1 );
+
+    const auto cell = row * m_columns + col;
+
+    // the indexes of a cell are in ascending order
+    for ( int i = m_cellOffsets[ cell ]; i < m_cellOffsets[ cell + 1 ]; i++ )
+    {
+        const auto index = m_indexes[i];
+        if ( m_rects[ index ].contains( pos ) )
+            return index;
+    }
+
+    return -1;
+}
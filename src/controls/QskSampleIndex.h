@@ -0,0 +1,82 @@
+/******************************************************************************
+ * QSkinny - Copyright (C) The authors
+ *           SPDX-License-Identifier: BSD-3-Clause
+ *****************************************************************************/
+
+#ifndef QSK_SAMPLE_INDEX_H
+#define QSK_SAMPLE_INDEX_H
+
+#include "QskGlobal.h"
+
+#include <qrect.h>
+#include <qvector.h>
+
+/*
+    A spatial index for finding the sample at a position in O(log n).
+
+    Samples, that are stacked horizontally or vertically without
+    overlapping are stored as sorted intervals. Otherwise the
+    samples are assigned to the cells of a uniform grid.
+
+    The index is usually built from QskSkinlet::sampleRect and identified
+    by a key, that changes with the conditions for the sample rectangles.
+ */
+class QSK_EXPORT QskSampleIndex
+{
+  public:
+    QskSampleIndex() = default;
+
+    // empty rectangles are never found
+    void setRects( const QVector< QRectF >& );
+    void clear();
+
+    bool isEmpty() const;
+
+    void setKey( QskHashValue ) noexcept;
+    QskHashValue key() const noexcept;
+
+    // the lowest index of the rectangles containing pos, or -1
+    int indexAt( const QPointF& pos ) const;
+
+  private:
+    int intervalIndexAt( const QPointF& ) const;
+    int gridIndexAt( const QPointF& ) const;
+
+    enum Mode : quint8 { Intervals, Grid };
+
+    QVector< QRectF > m_rects;
+
+    /*
+        Intervals: the indexes of the samples sorted along m_orientation
+        Grid:      the indexes of the samples for each cell, beginning
+                   at m_cellOffsets[ cell ]
+     */
+    QVector< int > m_indexes;
+    QVector< int > m_cellOffsets;
+
+    QRectF m_boundingRect;
+    int m_columns = 0;
+    int m_rows = 0;
+
+    QskHashValue m_key = 0;
+
+    Mode m_mode = Intervals;
+    Qt::Orientation m_orientation = Qt::Vertical;
+};
+
+inline bool QskSampleIndex::isEmpty() const
+{
+    return m_indexes.isEmpty();
+}
+
+inline void QskSampleIndex::setKey( QskHashValue key ) noexcept
+{
+    m_key = key;
+}
+
+inline QskHashValue QskSampleIndex::key() const noexcept
+{
+    return m_key;
+}
+
+#endif
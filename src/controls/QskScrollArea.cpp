@@ -9,12 +9,18 @@
 #include "QskScrollViewSkinlet.h"
 #include "QskBoxBorderMetrics.h"
 #include "QskSGNode.h"
+#include "QskBoxClipNode.h"
+#include "QskQuickItemPrivate.h"
 
 QSK_QT_PRIVATE_BEGIN
 #include <private/qquickitem_p.h>
 #include <private/qquickitemchangelistener_p.h>
 QSK_QT_PRIVATE_END
 
+#include <qsgvertexcolormaterial.h>
+
+#include <cstring>
+
 static inline bool qskNeedsScrollBars(
     qreal available, qreal required, Qt::ScrollBarPolicy policy )
 {
@@ -94,6 +100,52 @@ static inline QSizeF qskScrolledItemSize( const QskScrollView* scrollView,
     return itemSize;
 }
 
+static inline void qskSetItemCulled( QQuickItem* item, bool on )
+{
+    if ( auto qskItem = qobject_cast< QskQuickItem* >( item ) )
+    {
+        auto d = static_cast< QskQuickItemPrivate* >( QQuickItemPrivate::get( qskItem ) );
+        d->setViewportCulled( on );
+    }
+    else
+    {
+        QQuickItemPrivate::get( item )->setCulled( on );
+    }
+}
+
+static bool qskCopyGeometry( const QSGGeometry* from, QSGGeometry& to )
+{
+    /*
+        Sharing the geometry of a node from another subtree might
+        end up in dangling pointers, so we copy the vertexes
+        and return true when they have changed.
+     */
+    const int count = from ? from->vertexCount() : 0;
+
+    Q_ASSERT( from == nullptr || from->sizeOfVertex() == to.sizeOfVertex() );
+    Q_ASSERT( from == nullptr || from->indexCount() == 0 );
+
+    const auto size = count * to.sizeOfVertex();
+
+    if ( count == to.vertexCount()
+        && ( count == 0 || ( from->drawingMode() == to.drawingMode()
+            && memcmp( from->vertexData(), to.vertexData(), size ) == 0 ) ) )
+    {
+        return false;
+    }
+
+    to.allocate( count );
+
+    if ( count > 0 )
+    {
+        to.setDrawingMode( from->drawingMode() );
+        memcpy( to.vertexData(), from->vertexData(), size );
+    }
+
+    to.markVertexDataDirty();
+    return true;
+}
+
 namespace
 {
     class ViewportClipNode final : public QQuickDefaultClipNode
@@ -101,6 +153,7 @@ namespace
       public:
         ViewportClipNode()
             : QQuickDefaultClipNode( QRectF() )
+            , m_geometry( QSGGeometry::defaultAttributes_Point2D(), 0 )
         {
             setGeometry( nullptr );
 
@@ -108,10 +161,26 @@ namespace
             // is available to indicate our replaced clip node
 
             setFlag( QSGNode::OwnsMaterial, true );
+
+            // keeping the mask on top of the item nodes
+            setFlag( QSGNode::UsePreprocess, true );
+        }
+
+        ~ViewportClipNode() override
+        {
+            if ( m_maskNode )
+            {
+                if ( m_maskNode->parent() )
+                    removeChildNode( m_maskNode );
+
+                delete m_maskNode;
+            }
         }
 
         void copyFrom( const QSGClipNode* other )
         {
+            copyMaskFrom( dynamic_cast< const QskBoxClipNode* >( other ) );
+
             if ( other == nullptr )
             {
                 if ( !( isRectangular() && clipRect().isEmpty() ) )
@@ -152,10 +221,10 @@ namespace
                     isDirty = true;
                 }
 
-                if ( geometry() != other->geometry() )
+                if ( qskCopyGeometry( other->geometry(), m_geometry )
+                    || geometry() != &m_geometry )
                 {
-                    // both nodes share the same geometry
-                    setGeometry( const_cast< QSGGeometry* >( other->geometry() ) );
+                    setGeometry( &m_geometry );
                     isDirty = true;
                 }
             }
@@ -164,6 +233,11 @@ namespace
                 markDirty( QSGNode::DirtyGeometry );
         }
 
+        void resetMask()
+        {
+            copyMaskFrom( nullptr );
+        }
+
         void update() override
         {
             /*
@@ -173,6 +247,67 @@ namespace
                 into nops.
              */
         }
+
+        void preprocess() override
+        {
+            // see QskBoxClipNode::preprocess
+            if ( hasMask() && lastChild() != m_maskNode )
+            {
+                if ( m_maskNode->parent() )
+                    removeChildNode( m_maskNode );
+
+                appendChildNode( m_maskNode );
+            }
+        }
+
+      private:
+        inline bool hasMask() const
+        {
+            return m_maskNode && m_maskNode->geometry()->vertexCount() > 0;
+        }
+
+        void copyMaskFrom( const QskBoxClipNode* other )
+        {
+            /*
+                When the clip node of the viewport clips by a scissor
+                and masks the corners, the items need to be masked as well.
+             */
+            const auto geometry = other ? other->maskGeometry() : nullptr;
+
+            if ( geometry == nullptr )
+            {
+                if ( hasMask() )
+                {
+                    if ( m_maskNode->parent() )
+                        removeChildNode( m_maskNode );
+
+                    m_maskNode->geometry()->allocate( 0 );
+                }
+
+                return;
+            }
+
+            if ( m_maskNode == nullptr )
+            {
+                m_maskNode = new QSGGeometryNode();
+                m_maskNode->setFlag( QSGNode::OwnedByParent, false );
+
+                auto maskGeometry = new QSGGeometry(
+                    QSGGeometry::defaultAttributes_ColoredPoint2D(), 0 );
+
+                m_maskNode->setGeometry( maskGeometry );
+                m_maskNode->setFlag( QSGNode::OwnsGeometry, true );
+
+                m_maskNode->setMaterial( new QSGVertexColorMaterial() );
+                m_maskNode->setFlag( QSGNode::OwnsMaterial, true );
+            }
+
+            if ( qskCopyGeometry( geometry, *m_maskNode->geometry() ) )
+                m_maskNode->markDirty( QSGNode::DirtyGeometry );
+        }
+
+        QSGGeometry m_geometry;
+        QSGGeometryNode* m_maskNode = nullptr;
     };
 }
 
@@ -203,6 +338,8 @@ namespace
 
         void enableGeometryListener( bool on );
 
+        void setCulling( bool on );
+
         QQuickItem* scrolledItem() const
         {
             auto children = childItems();
@@ -239,11 +376,36 @@ namespace
 
         void itemChange( ItemChange, const ItemChangeData& ) override;
 
-        void itemGeometryChanged( QQuickItem*,
+        void itemGeometryChanged( QQuickItem* item,
             QQuickGeometryChange change, const QRectF& ) override
         {
-            if ( change.sizeChange() )
+            if ( item == scrolledItem() && change.sizeChange() )
                 scrolledItemGeometryChange();
+
+            if ( isCulling() )
+                polish();
+        }
+
+        void itemChildAdded( QQuickItem*, QQuickItem* child ) override
+        {
+            // a child of the scrolled item
+            QQuickItemPrivate::get( child )->addItemChangeListener(
+                this, QQuickItemPrivate::Geometry );
+
+            polish();
+        }
+
+        void itemChildRemoved( QQuickItem*, QQuickItem* child ) override
+        {
+            QQuickItemPrivate::get( child )->removeItemChangeListener(
+                this, QQuickItemPrivate::Geometry );
+
+            qskSetItemCulled( child, false );
+        }
+
+        void updateLayout() override
+        {
+            updateCulling();
         }
 
         void updateNode( QSGNode* ) override;
@@ -266,8 +428,19 @@ namespace
                 if ( clipRect() != node->clipRect() )
                     update();
             }
+
+            if ( isCulling() )
+                polish();
         }
 
+        inline bool isCulling() const
+        {
+            return scrollArea()->hasViewportCulling();
+        }
+
+        void enableCullingListeners( QQuickItem*, bool on );
+        void updateCulling();
+
         inline void scrolledItemGeometryChange()
         {
             if ( m_isSizeChangedEnabled )
@@ -303,6 +476,77 @@ namespace
     ClipItem::~ClipItem()
     {
         enableGeometryListener( false );
+
+        if ( isCulling() )
+        {
+            if ( auto item = scrolledItem() )
+                enableCullingListeners( item, false );
+        }
+    }
+
+    void ClipItem::setCulling( bool on )
+    {
+        auto item = scrolledItem();
+        if ( item == nullptr )
+            return;
+
+        enableCullingListeners( item, on );
+
+        if ( on )
+        {
+            polish();
+        }
+        else
+        {
+            const auto children = item->childItems();
+            for ( auto child : children )
+                qskSetItemCulled( child, false );
+        }
+    }
+
+    void ClipItem::enableCullingListeners( QQuickItem* item, bool on )
+    {
+        /*
+            Being notified about children being added/removed to/from the
+            scrolled item and about their geometries - usually
+            being modified from the layout code of the scrolled item.
+         */
+        auto d = QQuickItemPrivate::get( item );
+
+        if ( on )
+            d->addItemChangeListener( this, QQuickItemPrivate::Children );
+        else
+            d->removeItemChangeListener( this, QQuickItemPrivate::Children );
+
+        const auto children = item->childItems();
+        for ( auto child : children )
+        {
+            auto childPrivate = QQuickItemPrivate::get( child );
+
+            if ( on )
+                childPrivate->addItemChangeListener( this, QQuickItemPrivate::Geometry );
+            else
+                childPrivate->removeItemChangeListener( this, QQuickItemPrivate::Geometry );
+        }
+    }
+
+    void ClipItem::updateCulling()
+    {
+        auto item = scrolledItem();
+        if ( item == nullptr || !isCulling() )
+            return;
+
+        const auto margin = scrollArea()->cullingMargin();
+
+        auto rect = clipRect().adjusted( -margin, -margin, margin, margin );
+        rect = item->mapRectFromItem( this, rect );
+
+        const auto children = item->childItems();
+        for ( auto child : children )
+        {
+            const auto culled = !qskItemGeometry( child ).intersects( rect );
+            qskSetItemCulled( child, culled );
+        }
     }
 
     void ClipItem::updateNode( QSGNode* )
@@ -325,6 +569,9 @@ namespace
                 clipNode->setGeometry( nullptr );
             }
 
+            if ( clipNode && ( clipNode->flags() & QSGNode::OwnsMaterial ) )
+                static_cast< ViewportClipNode* >( clipNode )->resetMask();
+
             // in the next cycle we will find a valid clip
             update();
             return;
@@ -380,10 +627,23 @@ namespace
         if ( change == QQuickItem::ItemChildAddedChange )
         {
             enableGeometryListener( true );
+
+            if ( isCulling() )
+                setCulling( true );
         }
         else if ( change == QQuickItem::ItemChildRemovedChange )
         {
             enableGeometryListener( false );
+
+            if ( isCulling() && value.item )
+            {
+                // the item is not a child anymore
+                enableCullingListeners( value.item, false );
+
+                const auto children = value.item->childItems();
+                for ( auto child : children )
+                    qskSetItemCulled( child, false );
+            }
         }
 
         Inherited::itemChange( change, value );
@@ -421,6 +681,9 @@ namespace
             {
                 // we need to restore the clip node
                 update();
+
+                if ( isCulling() )
+                    polish();
             }
         }
 
@@ -434,6 +697,7 @@ class QskScrollArea::PrivateData
     PrivateData()
         : isItemResizable( true )
         , isItemFocusClipping( true )
+        , isViewportCulling( false )
     {
     }
 
@@ -452,9 +716,11 @@ class QskScrollArea::PrivateData
     }
 
     ClipItem* clipItem = nullptr;
+    qreal cullingMargin = 0.0;
 
     bool isItemResizable : 1;
     bool isItemFocusClipping : 1;
+    bool isViewportCulling : 1;
 };
 
 
@@ -593,6 +859,42 @@ bool QskScrollArea::hasItemFocusClipping() const
     return m_data->isItemFocusClipping;
 }
 
+void QskScrollArea::setViewportCulling( bool on )
+{
+    if ( on != m_data->isViewportCulling )
+    {
+        m_data->isViewportCulling = on;
+        m_data->clipItem->setCulling( on );
+
+        Q_EMIT viewportCullingChanged( on );
+    }
+}
+
+bool QskScrollArea::hasViewportCulling() const
+{
+    return m_data->isViewportCulling;
+}
+
+void QskScrollArea::setCullingMargin( qreal margin )
+{
+    margin = qMax( margin, 0.0 );
+
+    if ( margin != m_data->cullingMargin )
+    {
+        m_data->cullingMargin = margin;
+
+        if ( m_data->isViewportCulling )
+            m_data->clipItem->polish();
+
+        Q_EMIT cullingMarginChanged( margin );
+    }
+}
+
+qreal QskScrollArea::cullingMargin() const
+{
+    return m_data->cullingMargin;
+}
+
 void QskScrollArea::setScrolledItem( QQuickItem* item )
 {
     auto oldItem = m_data->clipItem->scrolledItem();
@@ -21,6 +21,12 @@ class QSK_EXPORT QskScrollArea : public QskScrollView
     Q_PROPERTY( bool itemFocusClipping READ hasItemFocusClipping
         WRITE setItemFocusClipping FINAL )
 
+    Q_PROPERTY( bool viewportCulling READ hasViewportCulling
+        WRITE setViewportCulling NOTIFY viewportCullingChanged FINAL )
+
+    Q_PROPERTY( qreal cullingMargin READ cullingMargin
+        WRITE setCullingMargin NOTIFY cullingMarginChanged FINAL )
+
     using Inherited = QskScrollView;
 
   public:
@@ -36,9 +42,26 @@ class QSK_EXPORT QskScrollArea : public QskScrollView
     void setItemFocusClipping( bool on );
     bool hasItemFocusClipping() const;
 
+    /*
+        Children of the scrolled item, that are entirely outside of the
+        viewport ( extended by cullingMargin ), are culled: they are not
+        rendered and - according to the DeferredPolish/DeferredUpdate flags -
+        excluded from polishing and updating their scene graph nodes.
+
+        This is useful for scrolled items with many children,
+        f.e. a QskLinearBox with thousands of cards.
+     */
+    void setViewportCulling( bool on );
+    bool hasViewportCulling() const;
+
+    void setCullingMargin( qreal );
+    qreal cullingMargin() const;
+
   Q_SIGNALS:
     void scrolledItemChanged();
     void itemResizableChanged( bool );
+    void viewportCullingChanged( bool );
+    void cullingMarginChanged( qreal );
 
   protected:
     void updateLayout() override;
@@ -138,7 +138,7 @@ void QskSegmentedBar::setOptions( const QVector< QskLabelData >& options )
     m_data->enabled.fill( true, options.count() );
 
     resetImplicitSize();
-    update();
+    setAllSamplesDirty();
 
     // selectedIndex ???
     Q_EMIT optionsChanged();
@@ -37,6 +37,15 @@ static inline const QskQuickItem::UpdateFlags qskEnvironmentUpdateFlags()
     if ( qskHasEnvironment( "QSK_PREFER_RASTER" ) )
         flags |= QskQuickItem::PreferRasterForTextures;
 
+    if ( qskHasEnvironment( "QSK_PREFER_VECTOR" ) )
+        flags |= QskQuickItem::PreferVectorForGraphics;
+
+    if ( qskHasEnvironment( "QSK_PREFER_GEOMETRY_SHADOWS" ) )
+        flags |= QskQuickItem::PreferGeometryForShadows;
+
+    if ( qskHasEnvironment( "QSK_OCCLUSION_CULLING" ) )
+        flags |= QskQuickItem::OcclusionCulling;
+
     if ( qskHasEnvironment( "QSK_FORCE_BACKGROUND" ) )
         flags |= QskQuickItem::DebugForceBackground;
 
@@ -19,9 +19,14 @@
 #include <qguiapplication.h>
 #include <qpa/qplatformdialoghelper.h>
 #include <qpa/qplatformtheme.h>
+#include <qthread.h>
+#include <qthreadpool.h>
 
+#include <algorithm>
 #include <cmath>
 #include <unordered_map>
+#include <unordered_set>
+#include <vector>
 
 #include "QskBox.h"
 #include "QskBoxSkinlet.h"
@@ -139,6 +144,33 @@ namespace
         const QMetaObject* metaObject;
         QskSkinlet* skinlet;
     };
+
+    class PendingHints
+    {
+      public:
+        const QMetaObject* metaObject;
+        std::vector< QskSkin::HintSetup > setups;
+    };
+}
+
+static inline void qskRunHintSetups(
+    const std::vector< QskSkin::HintSetup >& setups, QskSkinHintTable& table )
+{
+    for ( const auto& setup : setups )
+        setup( table );
+}
+
+static void qskMergeHints( const QskSkinHintTable& from, QskSkinHintTable& to )
+{
+    /*
+        Hints, that have been set after declaring the setup function -
+        f.e. customizations of the application - are not overwritten.
+     */
+    for ( const auto& entry : from.hints() )
+    {
+        if ( !to.hasHint( entry.first ) )
+            to.setHint( entry.first, entry.second );
+    }
 }
 
 class QskSkin::PrivateData
@@ -148,9 +180,15 @@ class QskSkin::PrivateData
 
     QskSkinHintTable hintTable;
 
+    // in order of declaration
+    std::vector< PendingHints > pendingHints;
+    std::unordered_set< const QMetaObject* > populatedClasses;
+
     std::unordered_map< int, QFont > fonts;
     std::unordered_map< int, QskColorFilter > graphicFilters;
 
+    quint32 revision = 0;
+
     QskGraphicProviderMap graphicProviders;
 };
 
@@ -246,6 +284,120 @@ void QskSkin::declareSkinlet( const QMetaObject* metaObject,
     }
 }
 
+void QskSkin::declareHints( const QMetaObject* metaObject, const HintSetup& setup )
+{
+    if ( metaObject == nullptr || !setup )
+        return;
+
+    const auto& populatedClasses = m_data->populatedClasses;
+    if ( populatedClasses.find( metaObject ) != populatedClasses.cend() )
+    {
+        // the hints of the class are already in use
+        setup( m_data->hintTable );
+        return;
+    }
+
+    auto& pendingHints = m_data->pendingHints;
+
+    auto it = std::find_if( pendingHints.begin(), pendingHints.end(),
+        [metaObject]( const PendingHints& entry ) { return entry.metaObject == metaObject; } );
+
+    if ( it != pendingHints.end() )
+        it->setups.push_back( setup );
+    else
+        pendingHints.push_back( { metaObject, { setup } } );
+}
+
+void QskSkin::populateHints( QskAspect::Subcontrol subControl ) const
+{
+    if ( m_data->pendingHints.empty() || subControl == QskAspect::NoSubcontrol )
+        return;
+
+    populateHints( QskAspect::subControlMetaObject( subControl ) );
+}
+
+void QskSkin::populateHints( const QMetaObject* metaObject ) const
+{
+    if ( metaObject == nullptr || m_data->pendingHints.empty() )
+        return;
+
+    /*
+        The hint table must not be modified, while being read from
+        another thread. As the scene graph thread reads it, while the
+        GUI thread is blocked, we populate from the thread of the skin only.
+        Controls populate their hints when being polished, so the
+        hints are available, when their nodes are updated.
+     */
+    if ( QThread::currentThread() != thread() )
+        return;
+
+    if ( !m_data->populatedClasses.insert( metaObject ).second )
+        return;
+
+    auto& pendingHints = m_data->pendingHints;
+
+    auto it = std::find_if( pendingHints.begin(), pendingHints.end(),
+        [metaObject]( const PendingHints& entry ) { return entry.metaObject == metaObject; } );
+
+    if ( it != pendingHints.end() )
+    {
+        const auto setups = std::move( it->setups );
+        pendingHints.erase( it );
+
+        QskSkinHintTable table;
+        qskRunHintSetups( setups, table );
+
+        qskMergeHints( table, m_data->hintTable );
+    }
+}
+
+void QskSkin::populateAllHints( bool parallel ) const
+{
+    const auto pendingHints = std::move( m_data->pendingHints );
+    m_data->pendingHints.clear();
+
+    if ( pendingHints.empty() )
+        return;
+
+    std::vector< std::unique_ptr< QskSkinHintTable > > tables;
+    tables.reserve( pendingHints.size() );
+
+    for ( const auto& entry : pendingHints )
+    {
+        m_data->populatedClasses.insert( entry.metaObject );
+        tables.emplace_back( new QskSkinHintTable() );
+    }
+
+    if ( parallel && pendingHints.size() > 1 )
+    {
+        QThreadPool threadPool;
+
+        for ( size_t i = 0; i < pendingHints.size(); i++ )
+        {
+            const auto setups = &pendingHints[i].setups;
+            const auto table = tables[i].get();
+
+            threadPool.start( [setups, table]() { qskRunHintSetups( *setups, *table ); } );
+        }
+
+        threadPool.waitForDone();
+    }
+    else
+    {
+        for ( size_t i = 0; i < pendingHints.size(); i++ )
+            qskRunHintSetups( pendingHints[i].setups, *tables[i] );
+    }
+
+    // merging in order of declaration
+    for ( const auto& table : tables )
+        qskMergeHints( *table, m_data->hintTable );
+}
+
+bool QskSkin::hasPendingHints() const
+{
+    return !m_data->pendingHints.empty();
+}
+
 void QskSkin::setupFonts( const QString& family, int weight, bool italic )
 {
     const int sizes[] = { 10, 15, 20, 32, 66 };
@@ -267,16 +419,19 @@ void QskSkin::setupFonts( const QString& family, int weight, bool italic )
         font.setPointSize( appFont.pointSize() );
 
     m_data->fonts[ QskSkin::DefaultFont ] = font;
+    m_data->revision++;
 }
 
 void QskSkin::setFont( int fontRole, const QFont& font )
 {
     m_data->fonts[ fontRole ] = font;
+    m_data->revision++;
 }
 
 void QskSkin::resetFont( int fontRole )
 {
-    m_data->fonts.erase( fontRole );
+    if ( m_data->fonts.erase( fontRole ) > 0 )
+        m_data->revision++;
 }
 
 QFont QskSkin::font( int fontRole ) const
@@ -295,11 +450,13 @@ QFont QskSkin::font( int fontRole ) const
 void QskSkin::setGraphicFilter( int graphicRole, const QskColorFilter& colorFilter )
 {
     m_data->graphicFilters[ graphicRole ] = colorFilter;
+    m_data->revision++;
 }
 
 void QskSkin::resetGraphicFilter( int graphicRole )
 {
-    m_data->graphicFilters.erase( graphicRole );
+    if ( m_data->graphicFilters.erase( graphicRole ) > 0 )
+        m_data->revision++;
 }
 
 QskColorFilter QskSkin::graphicFilter( int graphicRole ) const
@@ -311,6 +468,11 @@ QskColorFilter QskSkin::graphicFilter( int graphicRole ) const
     return QskColorFilter();
 }
 
+quint32 QskSkin::revision() const
+{
+    return m_data->revision;
+}
+
 const QskSkinHintTable& QskSkin::hintTable() const
 {
     return m_data->hintTable;
@@ -11,6 +11,7 @@
 #include <qcolor.h>
 #include <qobject.h>
 
+#include <functional>
 #include <memory>
 #include <type_traits>
 #include <unordered_map>
@@ -33,6 +34,8 @@ class QSK_EXPORT QskSkin : public QObject
     using Inherited = QObject;
 
   public:
+    using HintSetup = std::function< void( QskSkinHintTable& ) >;
+
     enum SkinFontRole
     {
         DefaultFont = 0,
@@ -64,6 +67,33 @@ class QSK_EXPORT QskSkin : public QObject
     template< typename Control, typename Skinlet >
     void declareSkinlet();
 
+    /*
+        Instead of filling the hint table for all controls in advance
+        a skin might declare setup functions for each control class.
+        They are called the first time a hint for one of the subcontrols
+        of the class is resolved.
+
+        The hints of a setup function are inserted into the hint table
+        without overwriting hints, that have been set in the meantime.
+
+        Populating is done in the thread of the skin only. Controls
+        populate the hints of all their subcontrols when being polished.
+     */
+    template< typename Control >
+    void declareHints( const HintSetup& );
+    void declareHints( const QMetaObject*, const HintSetup& );
+
+    void populateHints( QskAspect::Subcontrol ) const;
+    void populateHints( const QMetaObject* ) const;
+
+    /*
+        Running all pending setup functions. In parallel mode they are
+        called from worker threads - each of them with its own table,
+        that is merged afterwards. So the setup functions need to be reentrant.
+     */
+    void populateAllHints( bool parallel = false ) const;
+    bool hasPendingHints() const;
+
     virtual void resetColors( const QColor& accent );
 
     void setSkinHint( QskAspect, const QVariant& hint );
@@ -96,6 +126,12 @@ class QSK_EXPORT QskSkin : public QObject
     const std::unordered_map< int, QFont >& fonts() const;
     const std::unordered_map< int, QskColorFilter >& graphicFilters() const;
 
+    /*
+        Increased, whenever a font or graphic filter has been modified.
+        Modifications of the hint table are indicated by QskSkinHintTable::revision()
+     */
+    quint32 revision() const;
+
   private:
     void declareSkinlet( const QMetaObject* metaObject,
         const QMetaObject* skinletMetaObject );
@@ -112,4 +148,10 @@ inline void QskSkin::declareSkinlet()
     declareSkinlet( &Skinnable::staticMetaObject, &Skinlet::staticMetaObject );
 }
 
+template< typename Control >
+inline void QskSkin::declareHints( const HintSetup& setup )
+{
+    declareHints( &Control::staticMetaObject, setup );
+}
+
 #endif
@@ -7,24 +7,42 @@
 #include "QskAnimationHint.h"
 
 #include <limits>
+#include <new>
 
 const QVariant QskSkinHintTable::invalidHint;
 
-inline const QVariant* qskResolvedHint( QskAspect aspect,
-    const std::unordered_map< QskAspect, QVariant >& hints,
-    QskAspect* resolvedAspect )
+// the maximum number of entries before promoting to a hash map
+static const int compactSize = 8;
+
+using Entry = QskSkinHintTable::Entry;
+
+static inline Entry* qskAllocateEntries( int count )
+{
+    return static_cast< Entry* >( ::operator new( count * sizeof( Entry ) ) );
+}
+
+static inline void qskFreeEntries( Entry* entries, int count )
+{
+    for ( int i = 0; i < count; i++ )
+        entries[i].~Entry();
+
+    ::operator delete( entries );
+}
+
+template< typename Finder >
+static inline const QVariant* qskResolvedHint( QskAspect aspect,
+    const Finder& find, QskAspect* resolvedAspect )
 {
     auto a = aspect;
 
     Q_FOREVER
     {
-        auto it = hints.find( aspect );
-        if ( it != hints.cend() )
+        if ( const auto value = find( aspect ) )
         {
             if ( resolvedAspect )
                 *resolvedAspect = aspect;
 
-            return &it->second;
+            return value;
         }
 
 #if 1
@@ -76,120 +94,195 @@ QskSkinHintTable::QskSkinHintTable()
 
 QskSkinHintTable::~QskSkinHintTable()
 {
-    delete m_hints;
+    clear();
 }
 
-const std::unordered_map< QskAspect, QVariant >& QskSkinHintTable::hints() const
+void QskSkinHintTable::promote()
 {
-    if ( m_hints )
-        return *m_hints;
+    auto map = new HintMap();
+    map->reserve( m_count + 1 );
 
-    static std::unordered_map< QskAspect, QVariant > dummyHints;
-    return dummyHints;
+    auto entries = this->entries();
+    for ( int i = 0; i < m_count; i++ )
+        map->emplace( entries[i].first, std::move( entries[i].second ) );
+
+    qskFreeEntries( entries, m_count );
+
+    m_hints = map;
+    m_count = 0;
 }
 
 #define QSK_ASSERT_COUNTER( x ) Q_ASSERT( x < std::numeric_limits< decltype( x ) >::max() )
 
 bool QskSkinHintTable::setHint( QskAspect aspect, const QVariant& skinHint )
 {
-    if ( m_hints == nullptr )
-        m_hints = new HintMap();
-
-    auto it = m_hints->find( aspect );
-    if ( it == m_hints->end() )
+    if ( auto value = const_cast< QVariant* >( find( aspect ) ) )
     {
-        m_hints->emplace( aspect, skinHint );
+        if ( *value == skinHint )
+            return false;
+
+        *value = skinHint;
+        m_revision++;
 
-        if ( aspect.isAnimator() )
+        return true;
+    }
+
+    if ( m_hints == nullptr || m_count > 0 )
+    {
+        if ( m_count < compactSize )
         {
-            m_animatorCount++;
-            QSK_ASSERT_COUNTER( m_animatorCount );
-        }
+            /*
+                Tables usually get filled once, so we allocate the exact
+                size instead of paying for unused capacity.
+             */
+            auto entries = qskAllocateEntries( m_count + 1 );
 
-        m_states |= aspect.states();
+            auto oldEntries = this->entries();
+            for ( int i = 0; i < m_count; i++ )
+                new ( entries + i ) Entry( oldEntries[i].first, std::move( oldEntries[i].second ) );
 
-        return true;
+            new ( entries + m_count ) Entry( aspect, skinHint );
+
+            if ( oldEntries )
+                qskFreeEntries( oldEntries, m_count );
+
+            m_hints = entries;
+            m_count++;
+        }
+        else
+        {
+            promote();
+            map()->emplace( aspect, skinHint );
+        }
+    }
+    else
+    {
+        map()->emplace( aspect, skinHint );
     }
 
-    if ( it->second != skinHint )
+    if ( aspect.isAnimator() )
     {
-        it->second = skinHint;
-        return true;
+        m_animatorCount++;
+        QSK_ASSERT_COUNTER( m_animatorCount );
     }
 
-    return false;
+    m_states |= aspect.states();
+    m_revision++;
+
+    return true;
 }
 
 #undef QSK_ASSERT_COUNTER
 
-bool QskSkinHintTable::removeHint( QskAspect aspect )
+bool QskSkinHintTable::remove( QskAspect aspect, QVariant* value )
 {
-    if ( m_hints == nullptr )
-        return false;
+    if ( m_count > 0 )
+    {
+        auto entries = this->entries();
 
-    const bool erased = m_hints->erase( aspect );
+        int index = 0;
+        while ( index < m_count && entries[index].first != aspect )
+            index++;
 
-    if ( erased )
-    {
-        if ( aspect.isAnimator() )
-            m_animatorCount--;
+        if ( index == m_count )
+            return false;
 
-        // how to clear m_states ? TODO ...
+        if ( value )
+            *value = std::move( entries[index].second );
 
-        if ( m_hints->empty() )
+        if ( m_count == 1 )
         {
-            delete m_hints;
+            qskFreeEntries( entries, 1 );
             m_hints = nullptr;
         }
-    }
+        else
+        {
+            // the block is not shrunk, the last entry fills the gap
+            const auto last = m_count - 1;
 
-    return erased;
-}
+            entries[index].~Entry();
 
-QVariant QskSkinHintTable::takeHint( QskAspect aspect )
-{
-    if ( m_hints )
+            if ( index != last )
+            {
+                new ( entries + index ) Entry(
+                    entries[last].first, std::move( entries[last].second ) );
+
+                entries[last].~Entry();
+            }
+        }
+
+        m_count--;
+    }
+    else
     {
-        auto it = m_hints->find( aspect );
-        if ( it != m_hints->end() )
-        {
-            const auto value = it->second;
-            m_hints->erase( it );
+        if ( m_hints == nullptr )
+            return false;
 
-            if ( aspect.isAnimator() )
-                m_animatorCount--;
+        auto map = this->map();
 
-            // how to clear m_states ? TODO ...
+        auto it = map->find( aspect );
+        if ( it == map->end() )
+            return false;
 
-            if ( m_hints->empty() )
-            {
-                delete m_hints;
-                m_hints = nullptr;
-            }
+        if ( value )
+            *value = std::move( it->second );
 
-            return value;
+        map->erase( it );
+
+        if ( map->empty() )
+        {
+            delete map;
+            m_hints = nullptr;
         }
     }
 
-    return QVariant();
+    if ( aspect.isAnimator() )
+        m_animatorCount--;
+
+    // how to clear m_states ? TODO ...
+
+    m_revision++;
+
+    return true;
+}
+
+bool QskSkinHintTable::removeHint( QskAspect aspect )
+{
+    return remove( aspect, nullptr );
+}
+
+QVariant QskSkinHintTable::takeHint( QskAspect aspect )
+{
+    QVariant value;
+    remove( aspect, &value );
+
+    return value;
 }
 
 void QskSkinHintTable::clear()
 {
-    delete m_hints;
+    if ( m_count > 0 )
+        qskFreeEntries( entries(), m_count );
+    else
+        delete map();
+
     m_hints = nullptr;
+    m_count = 0;
 
     m_animatorCount = 0;
     m_states = QskAspect::NoState;
+
+    m_revision++;
 }
 
 const QVariant* QskSkinHintTable::resolvedHint(
     QskAspect aspect, QskAspect* resolvedAspect ) const
 {
-    if ( m_hints != nullptr )
-        return qskResolvedHint( aspect & m_states, *m_hints, resolvedAspect );
+    if ( m_hints == nullptr )
+        return nullptr;
 
-    return nullptr;
+    return qskResolvedHint( aspect & m_states,
+        [ this ]( QskAspect key ) { return find( key ); }, resolvedAspect );
 }
 
 QskAspect QskSkinHintTable::resolvedAspect( QskAspect aspect ) const
@@ -197,7 +290,10 @@ QskAspect QskSkinHintTable::resolvedAspect( QskAspect aspect ) const
     QskAspect a;
 
     if ( m_hints != nullptr )
-        qskResolvedHint( aspect & m_states, *m_hints, &a );
+    {
+        qskResolvedHint( aspect & m_states,
+            [ this ]( QskAspect key ) { return find( key ); }, &a );
+    }
 
     return a;
 }
@@ -211,10 +307,9 @@ QskAspect QskSkinHintTable::resolvedAnimator(
 
         Q_FOREVER
         {
-            auto it = m_hints->find( aspect );
-            if ( it != m_hints->cend() )
+            if ( const auto value = find( aspect ) )
             {
-                hint = it->second.value< QskAnimationHint >();
+                hint = value->value< QskAnimationHint >();
                 return aspect;
             }
 
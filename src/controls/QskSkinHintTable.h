@@ -9,6 +9,8 @@
 #include "QskAspect.h"
 
 #include <qvariant.h>
+
+#include <iterator>
 #include <unordered_map>
 
 class QskAnimationHint;
@@ -16,6 +18,54 @@ class QskAnimationHint;
 class QSK_EXPORT QskSkinHintTable
 {
   public:
+    using Entry = std::pair< const QskAspect, QVariant >;
+
+    class const_iterator
+    {
+      public:
+        using iterator_category = std::forward_iterator_tag;
+        using value_type = Entry;
+        using difference_type = std::ptrdiff_t;
+        using pointer = const Entry*;
+        using reference = const Entry&;
+
+        reference operator*() const;
+        pointer operator->() const;
+
+        const_iterator& operator++();
+
+        bool operator==( const const_iterator& ) const;
+        bool operator!=( const const_iterator& ) const;
+
+      private:
+        friend class QskSkinHintTable;
+
+        // m_entry for compact tables, m_it for hash maps
+        const Entry* m_entry = nullptr;
+        std::unordered_map< QskAspect, QVariant >::const_iterator m_it {};
+    };
+
+    // a lightweight range over the hints of a table
+    class Hints
+    {
+      public:
+        const_iterator begin() const;
+        const_iterator end() const;
+
+        size_t size() const;
+        bool empty() const;
+
+      private:
+        friend class QskSkinHintTable;
+
+        Hints( const QskSkinHintTable* table )
+            : m_table( table )
+        {
+        }
+
+        const QskSkinHintTable* m_table;
+    };
+
     QskSkinHintTable();
     ~QskSkinHintTable();
 
@@ -33,13 +83,20 @@ class QSK_EXPORT QskSkinHintTable
 
     bool hasHint( QskAspect ) const;
 
-    const std::unordered_map< QskAspect, QVariant >& hints() const;
+    Hints hints() const;
+    int hintCount() const;
+
+    // 0 for compact tables
+    size_t bucketCount() const;
 
     bool hasAnimators() const;
     bool hasHints() const;
 
     QskAspect::States states() const;
 
+    // incremented with each modification of the table
+    quint32 revision() const;
+
     void clear();
 
     const QVariant* resolvedHint( QskAspect,
@@ -57,11 +114,31 @@ class QSK_EXPORT QskSkinHintTable
 
     static const QVariant invalidHint;
 
-    typedef std::unordered_map< QskAspect, QVariant > HintMap;
-    HintMap* m_hints = nullptr;
+    using HintMap = std::unordered_map< QskAspect, QVariant >;
+
+    const QVariant* find( QskAspect ) const;
+    bool remove( QskAspect, QVariant* );
+    void promote();
+
+    inline Entry* entries() const { return static_cast< Entry* >( m_hints ); }
+    inline HintMap* map() const { return static_cast< HintMap* >( m_hints ); }
+
+    /*
+        Most local tables of the skinnables have only a couple of hints.
+        Up to compactSize of them are stored in a single heap block, that
+        is scanned linearly. Bigger tables - like the one of the skin -
+        are promoted to a hash map.
+
+        m_count is the number of entries in the block and 0, when
+        m_hints is a HintMap.
+     */
+    void* m_hints = nullptr;
 
+    quint8 m_count = 0;
     unsigned short m_animatorCount = 0;
     QskAspect::States m_states;
+
+    quint32 m_revision = 0;
 };
 
 inline bool QskSkinHintTable::hasHints() const
@@ -74,31 +151,142 @@ inline QskAspect::States QskSkinHintTable::states() const
     return m_states;
 }
 
+inline quint32 QskSkinHintTable::revision() const
+{
+    return m_revision;
+}
+
 inline bool QskSkinHintTable::hasAnimators() const
 {
     return m_animatorCount > 0;
 }
 
-inline bool QskSkinHintTable::hasHint( QskAspect aspect ) const
+inline const QVariant* QskSkinHintTable::find( QskAspect aspect ) const
 {
+    if ( m_count > 0 )
+    {
+        const auto entries = this->entries();
+
+        for ( int i = 0; i < m_count; i++ )
+        {
+            if ( entries[i].first == aspect )
+                return &entries[i].second;
+        }
+
+        return nullptr;
+    }
+
     if ( m_hints != nullptr )
-        return m_hints->find( aspect ) != m_hints->cend();
+    {
+        const auto map = this->map();
 
-    return false;
+        auto it = map->find( aspect );
+        if ( it != map->cend() )
+            return &it->second;
+    }
+
+    return nullptr;
+}
+
+inline bool QskSkinHintTable::hasHint( QskAspect aspect ) const
+{
+    return find( aspect ) != nullptr;
 }
 
 inline const QVariant& QskSkinHintTable::hint( QskAspect aspect ) const
 {
-    if ( m_hints != nullptr )
-    {
-        auto it = m_hints->find( aspect );
-        if ( it != m_hints->cend() )
-            return it->second;
-    }
+    if ( auto value = find( aspect ) )
+        return *value;
 
     return invalidHint;
 }
 
+inline QskSkinHintTable::Hints QskSkinHintTable::hints() const
+{
+    return Hints( this );
+}
+
+inline int QskSkinHintTable::hintCount() const
+{
+    if ( m_count > 0 )
+        return m_count;
+
+    return m_hints ? static_cast< int >( map()->size() ) : 0;
+}
+
+inline size_t QskSkinHintTable::bucketCount() const
+{
+    return ( m_count == 0 && m_hints ) ? map()->bucket_count() : 0;
+}
+
+inline QskSkinHintTable::const_iterator QskSkinHintTable::Hints::begin() const
+{
+    const_iterator it;
+
+    if ( m_table->m_count > 0 )
+        it.m_entry = m_table->entries();
+    else if ( m_table->m_hints )
+        it.m_it = m_table->map()->cbegin();
+
+    return it;
+}
+
+inline QskSkinHintTable::const_iterator QskSkinHintTable::Hints::end() const
+{
+    const_iterator it;
+
+    if ( m_table->m_count > 0 )
+        it.m_entry = m_table->entries() + m_table->m_count;
+    else if ( m_table->m_hints )
+        it.m_it = m_table->map()->cend();
+
+    return it;
+}
+
+inline size_t QskSkinHintTable::Hints::size() const
+{
+    return static_cast< size_t >( m_table->hintCount() );
+}
+
+inline bool QskSkinHintTable::Hints::empty() const
+{
+    return !m_table->hasHints();
+}
+
+inline QskSkinHintTable::const_iterator::reference
+    QskSkinHintTable::const_iterator::operator*() const
+{
+    return m_entry ? *m_entry : *m_it;
+}
+
+inline QskSkinHintTable::const_iterator::pointer
+    QskSkinHintTable::const_iterator::operator->() const
+{
+    return &operator*();
+}
+
+inline QskSkinHintTable::const_iterator& QskSkinHintTable::const_iterator::operator++()
+{
+    if ( m_entry )
+        m_entry++;
+    else
+        ++m_it;
+
+    return *this;
+}
+
+inline bool QskSkinHintTable::const_iterator::operator==(
+    const const_iterator& other ) const
+{
+    return ( m_entry == other.m_entry ) && ( m_it == other.m_it );
+}
+
+inline bool QskSkinHintTable::const_iterator::operator!=(
+    const const_iterator& other ) const
+{
+    return !( *this == other );
+}
+
 template< typename T >
 inline bool QskSkinHintTable::setHint( QskAspect aspect, const T& hint )
 {
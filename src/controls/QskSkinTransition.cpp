@@ -6,6 +6,7 @@
 #include "QskSkinTransition.h"
 #include "QskColorFilter.h"
 #include "QskControl.h"
+#include "QskQuickItemPrivate.h"
 #include "QskWindow.h"
 #include "QskAnimationHint.h"
 #include "QskHintAnimator.h"
@@ -20,16 +21,6 @@
 #include <unordered_map>
 #include <vector>
 
-static void qskSendStyleEventRecursive( QQuickItem* item )
-{
-    QEvent event( QEvent::StyleChange );
-    QCoreApplication::sendEvent( item, &event );
-
-    const auto children = item->childItems();
-    for ( auto child : children )
-        qskSendStyleEventRecursive( child );
-}
-
 static void qskAddCandidates( const QskSkinTransition::Type mask,
     const QskSkin* skin, QSet< QskAspect >& candidates )
 {
@@ -535,7 +526,7 @@ void ApplicationAnimator::cleanup( QQuickWindow* window )
             }
 
             // let the items know, that we are done
-            qskSendStyleEventRecursive( window->contentItem() );
+            QskQuickItemPrivate::invalidateSkin( window );
 
             break;
         }
@@ -620,6 +611,10 @@ void QskSkinTransition::process()
     {
         if ( ( m_data->animationHint.duration > 0 ) && ( m_data->mask != 0 ) )
         {
+            // the candidates are collected from the complete hint tables
+            skin1->populateAllHints();
+            skin2->populateAllHints();
+
             qskAddCandidates( m_data->mask, skin1, candidates );
             qskAddCandidates( m_data->mask, skin2, candidates );
         }
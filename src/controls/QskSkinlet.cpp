@@ -17,24 +17,35 @@
 #include "QskBoxHints.h"
 #include "QskColorFilter.h"
 #include "QskControl.h"
+#include "QskFrameProfiler.h"
 #include "QskFunctions.h"
 #include "QskGradient.h"
 #include "QskGraphicNode.h"
+#include "QskGraphicVectorNode.h"
 #include "QskGraphic.h"
 #include "QskLinesNode.h"
 #include "QskRectangleNode.h"
+#include "QskSampleIndex.h"
 #include "QskSGNode.h"
+#include "QskSkin.h"
+#include "QskSkinHintTable.h"
+#include "QskSkinTransition.h"
 #include "QskStippleMetrics.h"
 #include "QskTextColors.h"
 #include "QskTextNode.h"
 #include "QskTextOptions.h"
 #include "QskSkinStateChanger.h"
 #include "QskTextureRenderer.h"
+#include "QskTreeNode.h"
 #include "QskSetup.h"
 
+#include <qhash.h>
+#include <qmutex.h>
 #include <qquickwindow.h>
 #include <qsgsimplerectnode.h>
 
+#include <cmath>
+
 static inline QRectF qskSceneAlignedRect( const QQuickItem* item, const QRectF& rect )
 {
     const auto transform = item->itemTransform( nullptr, nullptr );
@@ -73,6 +84,26 @@ static inline QRectF qskSubControlRect( const QskSkinlet* skinlet,
     return QRectF();
 }
 
+static inline bool qskIsOpaque( const QskGradient& gradient )
+{
+    if ( !gradient.isValid() )
+        return false;
+
+    for ( const auto& stop : gradient.stops() )
+    {
+        if ( qAlpha( stop.rgb() ) < 255 )
+            return false;
+    }
+
+    return true;
+}
+
+static inline bool qskIsOpaque( const QskBoxBorderColors& colors )
+{
+    return qskIsOpaque( colors.left() ) && qskIsOpaque( colors.top() )
+        && qskIsOpaque( colors.right() ) && qskIsOpaque( colors.bottom() );
+}
+
 static inline QSGNode* qskUpdateTextNode( const QskSkinnable* skinnable,
     QSGNode* node, const QRectF& rect, Qt::Alignment alignment,
     const QString& text, const QFont& font, const QskTextOptions& textOptions,
@@ -110,6 +141,15 @@ static inline QSGNode* qskUpdateTextNode( const QskSkinnable* skinnable,
     return textNode;
 }
 
+static inline bool qskTestUpdateFlag(
+    const QQuickItem* item, QskQuickItem::UpdateFlag flag )
+{
+    if ( auto qItem = qobject_cast< const QskQuickItem* >( item ) )
+        return qItem->testUpdateFlag( flag );
+
+    return qskSetup->testItemUpdateFlag( flag );
+}
+
 static inline QSGNode* qskUpdateGraphicNode(
     const QskSkinnable* skinnable, QSGNode* node,
     const QskGraphic& graphic, const QskColorFilter& colorFilter,
@@ -122,21 +162,46 @@ static inline QSGNode* qskUpdateGraphicNode(
     if ( item == nullptr )
         return nullptr;
 
+    const auto r = qskSceneAlignedRect( item, rect );
+
+    if ( qskTestUpdateFlag( item, QskQuickItem::PreferVectorForGraphics ) )
+    {
+        // QskGraphicNode is a QskPaintedNode, what is not a transform node
+        const bool isVectorNode = node && ( node->type() == QSGNode::TransformNodeType );
+
+        if ( isVectorNode )
+        {
+            auto vectorNode = static_cast< QskGraphicVectorNode* >( node );
+            if ( vectorNode->setGraphic( graphic, colorFilter, r, mirrored ) )
+                return vectorNode;
+
+            // falling back to a texture
+            node = nullptr;
+        }
+        else if ( QskGraphicVectorNode::isSupported( graphic, colorFilter ) )
+        {
+            auto vectorNode = new QskGraphicVectorNode();
+            if ( vectorNode->setGraphic( graphic, colorFilter, r, mirrored ) )
+                return vectorNode;
+
+            delete vectorNode;
+        }
+    }
+    else if ( node && node->type() == QSGNode::TransformNodeType )
+    {
+        node = nullptr;
+    }
+
     auto graphicNode = static_cast< QskGraphicNode* >( node );
     if ( graphicNode == nullptr )
         graphicNode = new QskGraphicNode();
 
-    const auto flag = QskQuickItem::PreferRasterForTextures;
-
-    bool useRaster = qskSetup->testItemUpdateFlag( flag );
-    if ( auto qItem = qobject_cast< const QskQuickItem* >( item ) )
-        useRaster = qItem->testUpdateFlag( flag );
+    const bool useRaster = qskTestUpdateFlag(
+        item, QskQuickItem::PreferRasterForTextures );
 
     graphicNode->setRenderHint( useRaster ? QskPaintedNode::Raster : QskPaintedNode::OpenGL );
 
     graphicNode->setMirrored( mirrored );
-
-    const auto r = qskSceneAlignedRect( item, rect );
     graphicNode->setGraphic( item->window(), graphic, colorFilter, r );
 
     return graphicNode;
@@ -192,7 +257,7 @@ static inline QskTextColors qskTextColors(
 }
 
 static inline QSGNode* qskUpdateBoxNode(
-    const QskSkinnable*, QSGNode* node, const QRectF& rect,
+    const QskSkinnable* skinnable, QSGNode* node, const QRectF& rect,
     const QskBoxShapeMetrics& shape, const QskBoxBorderMetrics& borderMetrics,
     const QskBoxBorderColors& borderColors, const QskGradient& gradient,
     const QskShadowMetrics& shadowMetrics, const QColor& shadowColor )
@@ -210,6 +275,13 @@ static inline QSGNode* qskUpdateBoxNode(
         const auto absoluteShadowMetrics = shadowMetrics.toAbsolute( size );
 
         auto boxNode = QskSGNode::ensureNode< QskBoxNode >( node );
+
+        if ( const auto item = skinnable->owningItem() )
+        {
+            boxNode->setGeometryShadow( qskTestUpdateFlag(
+                item, QskQuickItem::PreferGeometryForShadows ) );
+        }
+
         boxNode->updateNode( rect, absoluteShape, absoluteMetrics,
             borderColors, gradient, absoluteShadowMetrics, shadowColor );
 
@@ -220,7 +292,7 @@ static inline QSGNode* qskUpdateBoxNode(
 }
 
 static inline QSGNode* qskUpdateArcNode(
-    const QskSkinnable*, QSGNode* node, const QRectF& rect,
+    const QskSkinnable* skinnable, QSGNode* node, const QRectF& rect,
     qreal borderWidth, const QColor borderColor,
     const QskGradient& gradient, const QskArcMetrics& metrics )
 {
@@ -231,6 +303,13 @@ static inline QSGNode* qskUpdateArcNode(
         return nullptr;
 
     auto arcNode = QskSGNode::ensureNode< QskArcNode >( node );
+
+    if ( const auto item = skinnable->owningItem() )
+    {
+        if ( const auto window = item->window() )
+            arcNode->setDevicePixelRatio( window->effectiveDevicePixelRatio() );
+    }
+
     arcNode->setArcData( rect, metrics, borderWidth, borderColor, gradient, {}, {} );
 
     return arcNode;
@@ -279,9 +358,53 @@ class QskSkinlet::PrivateData
     {
     }
 
+    QskAspect::States subcontrolStates(
+        const QskSkinHintTable& table, QskAspect::Subcontrol subControl )
+    {
+        /*
+            Skinlets are shared by all controls of a skin, and the nodes
+            of controls in different windows are updated from different
+            scene graph threads.
+         */
+        QMutexLocker locker( &stateMutex );
+
+        if ( &table != stateTable || table.revision() != stateTableRevision )
+        {
+            stateTable = &table;
+            stateTableRevision = table.revision();
+
+            stateCache.clear();
+        }
+
+        auto it = stateCache.constFind( subControl );
+        if ( it == stateCache.constEnd() )
+        {
+            // the states, that might have an effect on the resolved hints
+
+            QskAspect::States states;
+
+            for ( const auto& hint : table.hints() )
+            {
+                if ( hint.first.subControl() == subControl )
+                    states |= hint.first.states();
+            }
+
+            it = stateCache.insert( subControl, states );
+        }
+
+        return it.value();
+    }
+
     QskSkin* skin;
     QVector< quint8 > nodeRoles;
 
+    QHash< quint8, QVector< QskAspect::Subcontrol > > dependencies;
+
+    QMutex stateMutex;
+    const QskSkinHintTable* stateTable = nullptr;
+    quint32 stateTableRevision = 0;
+    QHash< quint16, QskAspect::States > stateCache;
+
     bool ownedBySkinnable : 1;
 };
 
@@ -324,6 +447,93 @@ const QVector< quint8 >& QskSkinlet::nodeRoles() const
     return m_data->nodeRoles;
 }
 
+void QskSkinlet::setNodeRoleDependencies( quint8 nodeRole,
+    const QVector< QskAspect::Subcontrol >& subControls )
+{
+    if ( subControls.isEmpty() )
+        m_data->dependencies.remove( nodeRole );
+    else
+        m_data->dependencies.insert( nodeRole, subControls );
+}
+
+QVector< QskAspect::Subcontrol > QskSkinlet::nodeRoleDependencies( quint8 nodeRole ) const
+{
+    return m_data->dependencies.value( nodeRole );
+}
+
+QskHashValue QskSkinlet::nodeRoleHash(
+    const QskSkinnable* skinnable, quint8 nodeRole ) const
+{
+    const auto it = m_data->dependencies.constFind( nodeRole );
+    if ( it == m_data->dependencies.constEnd() )
+        return 0;
+
+    /*
+        Animated hints are not found in the hint tables.
+        Instead of finding out if one of them is relevant for the node role
+        we simply do not skip anything during animations.
+     */
+    if ( QskSkinTransition::isRunning() || skinnable->hasRunningHintAnimators() )
+        return 0;
+
+    const auto skin = skinnable->effectiveSkin();
+    if ( skin == nullptr )
+        return 0;
+
+    const auto& skinTable = skin->hintTable();
+    const auto& localTable = skinnable->hintTable();
+
+    auto hash = qHash( quintptr( this ) );
+    hash = qHash( quintptr( skin ), hash );
+    hash = qHash( skin->revision(), hash ); // fonts, graphic filters
+    hash = qHash( skinTable.revision(), hash );
+    hash = qHash( localTable.revision(), hash );
+    hash = qHash( uint( skinnable->effectiveVariation() ), hash );
+    hash = qHash( uint( skinnable->section() ), hash );
+
+    const auto states = skinnable->skinStates();
+
+    for ( const auto subControl : *it )
+    {
+        const auto effectiveSubcontrol = skinnable->effectiveSubcontrol( subControl );
+
+        /*
+            Only the states, that appear in the hint tables for the subcontrol
+            are relevant. F.e. changing the Hovered bit does not affect
+            a subcontrol without any Hovered hints.
+         */
+        const auto relevantStates = localTable.states()
+            | m_data->subcontrolStates( skinTable, effectiveSubcontrol );
+
+        hash = qHash( uint( effectiveSubcontrol ), hash );
+        hash = qHash( uint( states & relevantStates ), hash );
+
+        const auto rect = qskSubControlRect( this, skinnable, subControl );
+
+        hash = qHash( rect.x(), hash );
+        hash = qHash( rect.y(), hash );
+        hash = qHash( rect.width(), hash );
+        hash = qHash( rect.height(), hash );
+    }
+
+    if ( const auto item = skinnable->owningItem() )
+    {
+        if ( const auto window = item->window() )
+        {
+            // see qskSceneAlignedRect
+
+            const auto ratio = window->devicePixelRatio();
+            const auto pos = item->mapToScene( QPointF() ) * ratio;
+
+            hash = qHash( ratio, hash );
+            hash = qHash( pos.x() - std::floor( pos.x() ), hash );
+            hash = qHash( pos.y() - std::floor( pos.y() ), hash );
+        }
+    }
+
+    return nodeHash( skinnable, nodeRole, hash );
+}
+
 void QskSkinlet::updateNode( QskSkinnable* skinnable, QSGNode* parentNode ) const
 {
     using namespace QskSGNode;
@@ -351,15 +561,87 @@ void QskSkinlet::updateNode( QskSkinnable* skinnable, QSGNode* parentNode ) cons
         replaceChildNode( DebugRole, parentNode, oldNode, newNode );
     }
 
+    QskFrameProfiler* profiler = nullptr;
+    if ( auto item = skinnable->owningItem() )
+        profiler = QskFrameProfiler::profiler( item->window() );
+
+    // the hashes of the previous updates are stored in the paint node
+    QskTreeNode* treeNode = nullptr;
+    if ( !m_data->dependencies.isEmpty() )
+        treeNode = qskTreeNodeCast( parentNode );
+
     for ( const auto nodeRole : std::as_const( m_data->nodeRoles ) )
     {
         Q_ASSERT( nodeRole < FirstReservedRole );
 
+        const auto startTime = profiler ? profiler->timestamp() : 0;
+
         oldNode = QskSGNode::findChildNode( parentNode, nodeRole );
+
+        QskHashValue hash = 0;
+
+        if ( treeNode )
+        {
+            hash = nodeRoleHash( skinnable, nodeRole );
+
+            if ( hash != 0 && oldNode && hash == treeNode->nodeHash( nodeRole ) )
+                continue; // nothing has changed
+        }
+
         newNode = updateSubNode( skinnable, nodeRole, oldNode );
 
         replaceChildNode( nodeRole, parentNode, oldNode, newNode );
+
+        if ( treeNode )
+            treeNode->setNodeHash( nodeRole, newNode ? hash : 0 );
+
+        if ( profiler )
+        {
+            profiler->addItemTiming( skinnable->owningItem(),
+                QskFrameProfiler::Sync, startTime, nodeRole );
+        }
+    }
+
+    skinnable->resetDirtySamples();
+}
+
+QRectF QskSkinlet::opaqueRect( const QskSkinnable* skinnable ) const
+{
+    if ( const auto control = skinnable->controlCast() )
+    {
+        if ( qskIsOpaque( control->background() ) )
+            return control->rect();
+    }
+
+    return QRectF();
+}
+
+QRectF QskSkinlet::opaqueBoxRect( const QskSkinnable* skinnable,
+    QskAspect::Subcontrol subControl ) const
+{
+    if ( !qskIsOpaque( skinnable->gradientHint( subControl ) ) )
+        return QRectF();
+
+    auto rect = qskSubControlRect( this, skinnable, subControl );
+    rect = rect.marginsRemoved( skinnable->marginHint( subControl ) );
+
+    if ( rect.isEmpty() )
+        return QRectF();
+
+    const auto shape = skinnable->boxShapeHint( subControl ).toAbsolute( rect.size() );
+    if ( !shape.isRectangle() )
+        return QRectF();
+
+    const auto borderMetrics =
+        skinnable->boxBorderMetricsHint( subControl ).toAbsolute( rect.size() );
+
+    if ( !borderMetrics.isNull() )
+    {
+        if ( !qskIsOpaque( skinnable->boxBorderColorsHint( subControl ) ) )
+            return QRectF();
     }
+
+    return rect;
 }
 
 QSGNode* QskSkinlet::updateBackgroundNode(
@@ -649,7 +931,9 @@ QSGNode* QskSkinlet::updateBoxClipNode( const QskSkinnable* skinnable,
         auto shape = skinnable->boxShapeHint( subControl );
         shape = shape.toAbsolute( clipRect.size() );
 
-        clipNode->setBox( clipRect, shape, borderMetrics );
+        const auto borderColors = skinnable->boxBorderColorsHint( subControl );
+
+        clipNode->setBox( clipRect, shape, borderMetrics, borderColors );
     }
 
     return clipNode;
@@ -749,60 +1033,205 @@ QSGNode* QskSkinlet::updateGraphicNode(
 int QskSkinlet::sampleIndexAt( const QskSkinnable* skinnable,
     const QRectF& rect, QskAspect::Subcontrol subControl, const QPointF& pos ) const
 {
-    // slow default implementation to be overloaded when having many cells
-
     const auto count = sampleCount( skinnable, subControl );
 
-    for ( int i = 0; i < count; i++ )
+    /*
+        For many samples we maintain a spatial index, that is
+        rebuilt, when the conditions for the sample rectangles change.
+        During animations the rectangles might change without
+        any notice, so we fall back to a linear search.
+     */
+    const int minIndexedCount = 16;
+
+    QskHashValue hash = 0;
+    if ( count >= minIndexedCount )
+        hash = sampleIndexHash( skinnable, rect, subControl, count );
+
+    if ( hash == 0 )
     {
-        const auto r = sampleRect( skinnable, rect, subControl, i );
-        if ( r.contains( pos ) )
-            return i;
+        for ( int i = 0; i < count; i++ )
+        {
+            const auto r = sampleRect( skinnable, rect, subControl, i );
+            if ( r.contains( pos ) )
+                return i;
+        }
+
+        return -1;
+    }
+
+    auto& index = skinnable->sampleIndex( subControl );
+
+    if ( index.key() != hash )
+    {
+        QVector< QRectF > rects;
+        rects.reserve( count );
+
+        for ( int i = 0; i < count; i++ )
+            rects += sampleRect( skinnable, rect, subControl, i );
+
+        index.setRects( rects );
+        index.setKey( hash );
     }
 
-    return -1;
+    return index.indexAt( pos );
+}
+
+QskHashValue QskSkinlet::sampleIndexHash( const QskSkinnable* skinnable,
+    const QRectF& rect, QskAspect::Subcontrol subControl, int sampleCount ) const
+{
+    if ( QskSkinTransition::isRunning() || skinnable->hasRunningHintAnimators() )
+        return 0;
+
+    const auto skin = skinnable->effectiveSkin();
+    if ( skin == nullptr )
+        return 0;
+
+    auto hash = qHash( quintptr( this ) );
+    hash = qHash( quintptr( skin ), hash );
+    hash = qHash( skin->revision(), hash );
+    hash = qHash( skin->hintTable().revision(), hash );
+
+    /*
+        Local hints are not part of the key: setting them invalidates
+        the indexes ( see QskSkinnable::setSkinHint ), unless they
+        are positions like the hover position of QskMenu.
+     */
+    hash = qHash( uint( skinnable->effectiveVariation() ), hash );
+    hash = qHash( uint( skinnable->section() ), hash );
+    hash = qHash( uint( skinnable->skinStates() ), hash );
+    hash = qHash( uint( skinnable->effectiveSubcontrol( subControl ) ), hash );
+    hash = qHash( sampleCount, hash );
+
+    hash = qHash( rect.x(), hash );
+    hash = qHash( rect.y(), hash );
+    hash = qHash( rect.width(), hash );
+    hash = qHash( rect.height(), hash );
+
+    return hash ? hash : 1;
+}
+
+QskHashValue QskSkinlet::seriesHash( const QskSkinnable* skinnable,
+    QskAspect::Subcontrol subControl, int sampleCount ) const
+{
+    /*
+        The conditions, that affect all samples. Changes of the local
+        hints are covered by QskSkinnable::setSamplesDirty.
+     */
+    if ( QskSkinTransition::isRunning() || skinnable->hasRunningHintAnimators() )
+        return 0;
+
+    const auto skin = skinnable->effectiveSkin();
+    if ( skin == nullptr )
+        return 0;
+
+    auto hash = qHash( quintptr( this ) );
+    hash = qHash( quintptr( skin ), hash );
+    hash = qHash( skin->revision(), hash );
+    hash = qHash( skin->hintTable().revision(), hash );
+    hash = qHash( uint( skinnable->effectiveVariation() ), hash );
+    hash = qHash( uint( skinnable->section() ), hash );
+    hash = qHash( uint( skinnable->skinStates() ), hash );
+    hash = qHash( uint( skinnable->effectiveSubcontrol( subControl ) ), hash );
+    hash = qHash( sampleCount, hash );
+
+    if ( const auto item = skinnable->owningItem() )
+    {
+        hash = qHash( item->width(), hash );
+        hash = qHash( item->height(), hash );
+    }
+
+    return hash ? hash : 1;
+}
+
+static inline QSGNode* qskSamplePlaceholder( QSGNode* node )
+{
+    if ( QskSGNode::nodeRole( node ) == QskSGNode::PlaceholderRole )
+        return node;
+
+    return QskSGNode::createNode< QSGNode >( QskSGNode::PlaceholderRole );
 }
 
 QSGNode* QskSkinlet::updateSeriesNode( const QskSkinnable* skinnable,
     QskAspect::Subcontrol subControl, QSGNode* rootNode ) const
 {
-    auto node = rootNode ? rootNode->firstChild() : nullptr;
-    QSGNode* lastNode = nullptr;
-
     const auto count = sampleCount( skinnable, subControl );
 
-    for( int i = 0; i < count; i++ )
+    auto updateSample = [ this, skinnable, subControl ]( int index, QSGNode* node )
     {
-        QSGNode* newNode = nullptr;
+        const auto newStates = sampleStates( skinnable, subControl, index );
 
-        {
-            const auto newStates = sampleStates( skinnable, subControl, i );
+        QskSkinStateChanger stateChanger( skinnable );
+        stateChanger.setStates( newStates, index );
 
-            QskSkinStateChanger stateChanger( skinnable );
-            stateChanger.setStates( newStates, i );
+        /*
+            Each sample has a node, so that the index of a sample is the
+            index of its node. For samples without content this is an
+            empty placeholder, that is not passed to updateSampleNode.
+         */
+        auto sampleNode = node;
+        if ( QskSGNode::nodeRole( sampleNode ) == QskSGNode::PlaceholderRole )
+            sampleNode = nullptr;
 
-            newNode = updateSampleNode( skinnable, subControl, i, node );
-        }
+        sampleNode = updateSampleNode( skinnable, subControl, index, sampleNode );
+        return sampleNode ? sampleNode : qskSamplePlaceholder( node );
+    };
+
+    const auto hash = seriesHash( skinnable, subControl, count );
+    const auto oldHash = skinnable->swapSeriesHash( subControl, hash );
+
+    if ( rootNode && hash != 0 && hash == oldHash
+        && skinnable->hasDirtySamples() && rootNode->childCount() == count )
+    {
+        // each sample has a node and only some of them need to be updated
 
-        if ( newNode )
+        auto node = rootNode->firstChild();
+
+        for ( int i = 0; i < count; i++ )
         {
-            if ( newNode == node )
-            {
-                node = node->nextSibling();
-            }
-            else
-            {
-                if ( rootNode == nullptr )
-                    rootNode = new QSGNode();
+            auto nextNode = node->nextSibling();
 
-                if ( node )
+            if ( skinnable->isSampleDirty( i ) )
+            {
+                auto newNode = updateSample( i, node );
+                if ( newNode != node )
+                {
                     rootNode->insertChildNodeBefore( newNode, node );
-                else
-                    rootNode->appendChildNode( newNode );
+
+                    rootNode->removeChildNode( node );
+                    if ( node->flags() & QSGNode::OwnedByParent )
+                        delete node;
+                }
             }
 
-            lastNode = newNode;
+            node = nextNode;
+        }
+
+        return rootNode;
+    }
+
+    auto node = rootNode ? rootNode->firstChild() : nullptr;
+    QSGNode* lastNode = nullptr;
+
+    for( int i = 0; i < count; i++ )
+    {
+        auto newNode = updateSample( i, node );
+
+        if ( newNode == node )
+        {
+            node = node->nextSibling();
+        }
+        else
+        {
+            if ( rootNode == nullptr )
+                rootNode = new QSGNode();
+
+            if ( node )
+                rootNode->insertChildNodeBefore( newNode, node );
+            else
+                rootNode->appendChildNode( newNode );
         }
+
+        lastNode = newNode;
     }
 
     QskSGNode::removeAllChildNodesAfter( rootNode, lastNode );
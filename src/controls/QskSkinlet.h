@@ -48,6 +48,12 @@ class QSK_EXPORT QskSkinlet
     virtual QRectF subControlRect( const QskSkinnable*,
         const QRectF&, QskAspect::Subcontrol ) const;
 
+    /*
+        The area, that is completely covered by opaque nodes.
+        Used for occlusion culling ( see QskQuickItem::OcclusionCulling )
+     */
+    virtual QRectF opaqueRect( const QskSkinnable* ) const;
+
     /*
         When having more than one instance for the
         same QskAspect::Subcontrol it is called a sample
@@ -68,6 +74,9 @@ class QSK_EXPORT QskSkinlet
 
     const QVector< quint8 >& nodeRoles() const;
 
+    // subcontrols, whose skin hints are the input of a node role
+    QVector< QskAspect::Subcontrol > nodeRoleDependencies( quint8 nodeRole ) const;
+
     void setOwnedBySkinnable( bool on );
     bool isOwnedBySkinnable() const;
 
@@ -137,6 +146,21 @@ class QSK_EXPORT QskSkinlet
     void setNodeRoles( const QVector< quint8 >& );
     void appendNodeRoles( const QVector< quint8 >& );
 
+    /*
+        Declaring the subcontrols a node role depends on enables skipping
+        updateSubNode, when the resolved skin hints of these subcontrols,
+        their subControlRect and the result of nodeHash have not changed
+        since the previous update.
+
+        Any other input of the node ( text, value, ... ) has to be
+        added in nodeHash, or the node role must not have dependencies.
+     */
+    void setNodeRoleDependencies( quint8 nodeRole,
+        const QVector< QskAspect::Subcontrol >& );
+
+    virtual QskHashValue nodeHash( const QskSkinnable*,
+        quint8 nodeRole, QskHashValue seed ) const;
+
     virtual QSGNode* updateSubNode( const QskSkinnable*,
         quint8 nodeRole, QSGNode* ) const;
 
@@ -149,6 +173,9 @@ class QSK_EXPORT QskSkinlet
     QSGNode* updateBoxNode( const QskSkinnable*, QSGNode*,
         QskAspect::Subcontrol ) const;
 
+    // the rectangle of the box, when being opaque, otherwise an empty rectangle
+    QRectF opaqueBoxRect( const QskSkinnable*, QskAspect::Subcontrol ) const;
+
     QSGNode* updateArcNode( const QskSkinnable*, QSGNode*,
         QskAspect::Subcontrol ) const;
 
@@ -184,6 +211,13 @@ class QSK_EXPORT QskSkinlet
   private:
     Q_DISABLE_COPY( QskSkinlet )
 
+    QskHashValue nodeRoleHash( const QskSkinnable*, quint8 nodeRole ) const;
+    QskHashValue seriesHash( const QskSkinnable*,
+        QskAspect::Subcontrol, int sampleCount ) const;
+
+    QskHashValue sampleIndexHash( const QskSkinnable*, const QRectF&,
+        QskAspect::Subcontrol, int sampleCount ) const;
+
     class PrivateData;
     std::unique_ptr< PrivateData > m_data;
 };
@@ -194,6 +228,12 @@ inline QRectF QskSkinlet::subControlRect(
     return QRectF();
 }
 
+inline QskHashValue QskSkinlet::nodeHash(
+    const QskSkinnable*, quint8, QskHashValue seed ) const
+{
+    return seed;
+}
+
 inline QSGNode* QskSkinlet::updateSubNode(
     const QskSkinnable*, quint8, QSGNode*) const
 {
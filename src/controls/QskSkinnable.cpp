@@ -12,6 +12,7 @@
 #include "QskControl.h"
 #include "QskHintAnimator.h"
 #include "QskMargins.h"
+#include "QskSampleIndex.h"
 #include "QskSetup.h"
 #include "QskSkin.h"
 #include "QskSkinHintTable.h"
@@ -31,7 +32,9 @@
 
 #include <qfont.h>
 #include <qfontmetrics.h>
+#include <algorithm>
 #include <map>
+#include <vector>
 
 #define DEBUG_MAP 0
 #define DEBUG_ANIMATOR 0
@@ -209,6 +212,21 @@ static inline void qskTriggerUpdates( QskAspect aspect, QQuickItem* item )
     }
 }
 
+static inline bool qskMightMoveSamples( QskAspect aspect )
+{
+    /*
+        Positions are usually stored temporarily - f.e the hover position
+        of a menu - and do not affect the geometry of the samples.
+     */
+    if ( aspect.isAnimator() || aspect.isColor() )
+        return false;
+
+    if ( aspect.isMetric() && aspect.metricPrimitive() == QskAspect::Position )
+        return false;
+
+    return true;
+}
+
 static inline QskAspect qskSubstitutedAspect(
     const QskSkinnable* skinnable, QskAspect aspect )
 {
@@ -231,6 +249,13 @@ static inline QskAspect qskSubstitutedAspect(
     return aspect;
 }
 
+static inline bool qskProxyLessThan(
+    const std::pair< QskAspect::Subcontrol, QskAspect::Subcontrol >& proxy,
+    QskAspect::Subcontrol subControl )
+{
+    return proxy.first < subControl;
+}
+
 class QskSkinnable::PrivateData
 {
   public:
@@ -241,8 +266,17 @@ class QskSkinnable::PrivateData
             if ( skinlet && skinlet->isOwnedBySkinnable() )
                 delete skinlet;
         }
+    }
 
-        delete subcontrolProxies;
+    inline const QskAspect::Subcontrol* proxy( QskAspect::Subcontrol subControl ) const
+    {
+        const auto it = std::lower_bound( subcontrolProxies.cbegin(),
+            subcontrolProxies.cend(), subControl, qskProxyLessThan );
+
+        if ( it != subcontrolProxies.cend() && it->first == subControl )
+            return &it->second;
+
+        return nullptr;
     }
 
     QskSkinHintTable hintTable;
@@ -250,11 +284,26 @@ class QskSkinnable::PrivateData
 
     int sampleIndex = -1; // for the ugly QskSkinStateChanger hack
 
-    typedef std::map< QskAspect::Subcontrol, QskAspect::Subcontrol > ProxyMap;
-    ProxyMap* subcontrolProxies = nullptr;
+    /*
+        Only a few controls have proxies, and those have only a couple of them:
+        a sorted vector is much leaner than a std::map with its nodes.
+     */
+    using Proxy = std::pair< QskAspect::Subcontrol, QskAspect::Subcontrol >;
+    std::vector< Proxy > subcontrolProxies;
 
     const QskSkinlet* skinlet = nullptr;
 
+    // see setSamplesDirty
+    std::vector< std::pair< int, int > > dirtySamples;
+    quint32 dirtySamplesRevision = 0;
+    bool allSamplesDirty = false;
+
+    // the conditions of the previous updates of the sample nodes
+    std::map< QskAspect::Subcontrol, QskHashValue > seriesHashes;
+
+    // see QskSkinlet::sampleIndexAt
+    std::map< QskAspect::Subcontrol, QskSampleIndex > sampleIndexes;
+
     QskAspect::States skinStates;
     bool hasLocalSkinlet = false;
 };
@@ -303,6 +352,90 @@ const QskSkinlet* QskSkinnable::skinlet() const
     return m_data->hasLocalSkinlet ? m_data->skinlet : nullptr;
 }
 
+void QskSkinnable::setSampleDirty( int index )
+{
+    setSamplesDirty( index, index );
+}
+
+void QskSkinnable::setSamplesDirty( int from, int to )
+{
+    if ( from < 0 || to < from )
+        return;
+
+    if ( !m_data->allSamplesDirty )
+    {
+        m_data->dirtySamples.emplace_back( from, to );
+        m_data->dirtySamplesRevision = m_data->hintTable.revision();
+    }
+
+    if ( auto item = owningItem() )
+        item->update();
+}
+
+void QskSkinnable::setAllSamplesDirty()
+{
+    m_data->allSamplesDirty = true;
+    m_data->dirtySamples.clear();
+
+    // the sample rectangles might have changed as well
+    m_data->sampleIndexes.clear();
+
+    if ( auto item = owningItem() )
+        item->update();
+}
+
+bool QskSkinnable::isSampleDirty( int index ) const
+{
+    if ( !hasDirtySamples() )
+        return true;
+
+    for ( const auto& range : m_data->dirtySamples )
+    {
+        if ( index >= range.first && index <= range.second )
+            return true;
+    }
+
+    return false;
+}
+
+bool QskSkinnable::hasDirtySamples() const
+{
+    /*
+        When local hints have been modified after marking
+        the samples we can't rely on the dirty samples.
+     */
+    return !( m_data->allSamplesDirty || m_data->dirtySamples.empty() )
+        && ( m_data->dirtySamplesRevision == m_data->hintTable.revision() );
+}
+
+void QskSkinnable::resetDirtySamples() const
+{
+    m_data->allSamplesDirty = false;
+    m_data->dirtySamples.clear();
+}
+
+QskHashValue QskSkinnable::swapSeriesHash(
+    QskAspect::Subcontrol subControl, QskHashValue hash ) const
+{
+    auto& value = m_data->seriesHashes[ subControl ];
+
+    const auto oldHash = value;
+    value = hash;
+
+    return oldHash;
+}
+
+QskSampleIndex& QskSkinnable::sampleIndex( QskAspect::Subcontrol subControl ) const
+{
+    return m_data->sampleIndexes[ subControl ];
+}
+
+void QskSkinnable::resetCachedSkinlet()
+{
+    if ( !m_data->hasLocalSkinlet )
+        m_data->skinlet = nullptr;
+}
+
 const QskSkinlet* QskSkinnable::effectiveSkinlet() const
 {
     if ( m_data->skinlet == nullptr )
@@ -326,37 +459,45 @@ void QskSkinnable::setSubcontrolProxy(
         return;
     }
 
-    if ( m_data->subcontrolProxies == nullptr )
-        m_data->subcontrolProxies = new PrivateData::ProxyMap();
+    auto& proxies = m_data->subcontrolProxies;
+
+    auto it = std::lower_bound( proxies.begin(),
+        proxies.end(), subControl, qskProxyLessThan );
 
-    ( *m_data->subcontrolProxies )[ subControl ] = proxy;
+    if ( it != proxies.end() && it->first == subControl )
+    {
+        it->second = proxy;
+    }
+    else
+    {
+        // growing one by one: proxies are set once and never many
+        const auto index = it - proxies.begin();
+
+        proxies.reserve( proxies.size() + 1 );
+        proxies.emplace( proxies.begin() + index, subControl, proxy );
+    }
 }
 
 void QskSkinnable::resetSubcontrolProxy( QskAspect::Subcontrol subcontrol )
 {
-    if ( auto& proxies = m_data->subcontrolProxies )
+    auto& proxies = m_data->subcontrolProxies;
+
+    auto it = std::lower_bound( proxies.begin(),
+        proxies.end(), subcontrol, qskProxyLessThan );
+
+    if ( it != proxies.end() && it->first == subcontrol )
     {
-        auto it = proxies->find( subcontrol );
-        if ( it != proxies->end() )
-        {
-            proxies->erase( it );
-            if ( proxies->empty() )
-            {
-                delete proxies;
-                proxies = nullptr;
-            }
-        }
+        proxies.erase( it );
+
+        if ( proxies.empty() )
+            proxies.shrink_to_fit();
     }
 }
 
 QskAspect::Subcontrol QskSkinnable::subcontrolProxy( QskAspect::Subcontrol subControl ) const
 {
-    if ( const auto proxies = m_data->subcontrolProxies )
-    {
-        auto it = proxies->find( subControl );
-        if ( it != proxies->end() )
-            return it->second;
-    }
+    if ( const auto proxy = m_data->proxy( subControl ) )
+        return *proxy;
 
     return QskAspect::NoSubcontrol;
 }
@@ -871,6 +1012,8 @@ QskAnimationHint QskSkinnable::effectiveAnimation(
 
     if ( auto skin = effectiveSkin() )
     {
+        skin->populateHints( aspect.subControl() );
+
         const auto a = skin->hintTable().resolvedAnimator( aspect, hint );
         if ( a.isAnimator() )
         {
@@ -899,6 +1042,9 @@ bool QskSkinnable::setSkinHint( QskAspect aspect, const QVariant& hint )
 
     if ( m_data->hintTable.setHint( aspect, hint ) )
     {
+        if ( qskMightMoveSamples( aspect ) )
+            m_data->sampleIndexes.clear();
+
         qskTriggerUpdates( aspect, owningItem() );
         return true;
     }
@@ -912,6 +1058,9 @@ bool QskSkinnable::resetSkinHint( QskAspect aspect )
 
     if ( m_data->hintTable.removeHint( aspect ) )
     {
+        if ( qskMightMoveSamples( aspect ) )
+            m_data->sampleIndexes.clear();
+
         qskTriggerUpdates( aspect, owningItem() );
         return true;
     }
@@ -1005,6 +1154,11 @@ const QskHintAnimator* QskSkinnable::runningHintAnimator(
     return animator;
 }
 
+bool QskSkinnable::hasRunningHintAnimators() const
+{
+    return !m_data->animators.isEmpty();
+}
+
 QVariant QskSkinnable::animatedHint(
     QskAspect aspect, QskSkinHintStatus* status ) const
 {
@@ -1109,6 +1263,8 @@ const QVariant& QskSkinnable::storedHint(
 
     // next we try the hints from the skin
 
+    skin->populateHints( aspect.subControl() );
+
     const auto& skinTable = skin->hintTable();
     if ( skinTable.hasHints() )
     {
@@ -1384,6 +1540,9 @@ void QskSkinnable::setSkinStates( QskAspect::States newStates )
     if ( m_data->skinStates == newStates )
         return;
 
+    // the states of the skin table need to be complete
+    populateSkinHints();
+
     auto item = owningItem();
 
 #if DEBUG_STATE
@@ -1507,6 +1666,20 @@ bool QskSkinnable::startHintTransitions(
     return started;
 }
 
+void QskSkinnable::populateSkinHints() const
+{
+    const auto skin = effectiveSkin();
+    if ( skin == nullptr || !skin->hasPendingHints() )
+        return;
+
+    if ( const auto control = qskControlCast( owningItem() ) )
+    {
+        const auto subControls = control->subControls();
+        for ( const auto subControl : subControls )
+            skin->populateHints( effectiveSubcontrol( subControl ) );
+    }
+}
+
 QskSkin* QskSkinnable::effectiveSkin() const
 {
     QskSkin* skin = nullptr;
@@ -1541,12 +1714,8 @@ void QskSkinnable::updateNode( QSGNode* parentNode )
 QskAspect::Subcontrol QskSkinnable::effectiveSubcontrol(
     QskAspect::Subcontrol subControl ) const
 {
-    if ( const auto proxies = m_data->subcontrolProxies )
-    {
-        auto it = proxies->find( subControl );
-        if ( it != proxies->end() )
-            return it->second;
-    }
+    if ( const auto proxy = m_data->proxy( subControl ) )
+        return *proxy;
 
     return substitutedSubcontrol( subControl );
 }
@@ -39,6 +39,7 @@ class QskGraphic;
 
 class QskSkin;
 class QskSkinlet;
+class QskSampleIndex;
 class QskSkinHintTable;
 class QskSkinStateChanger;
 
@@ -264,6 +265,25 @@ class QSK_EXPORT QskSkinnable
         QskAspect::States, QskAspect::States, int index = -1 );
 
     const QskHintAnimator* runningHintAnimator( QskAspect, int index = -1 ) const;
+    bool hasRunningHintAnimators() const;
+
+    /*
+        Restricting the next update of the sample nodes ( see
+        QskSkinlet::updateSeriesNode ) to the samples, that have been
+        marked dirty. Marking samples dirty claims, that nothing else
+        relevant for the samples has been changed since the last update
+        and has to be done after modifying any local skin hint.
+        Otherwise all samples are updated.
+
+        setAllSamplesDirty has to be called, when the samples have been
+        modified in a way, that is not indicated by the number of samples
+        or any skin hint. It also invalidates the index for sampleIndexAt.
+     */
+    void setSampleDirty( int index );
+    void setSamplesDirty( int from, int to );
+    void setAllSamplesDirty();
+
+    bool isSampleDirty( int index ) const;
 
   protected:
     virtual void updateNode( QSGNode* );
@@ -273,6 +293,12 @@ class QSK_EXPORT QskSkinnable
 
     QskSkinHintTable& hintTable();
 
+    // forgetting the skinlet of the skin without updating anything
+    void resetCachedSkinlet();
+
+    // running the pending hint setups of the skin: see QskSkin::declareHints
+    void populateSkinHints() const;
+
   private:
     Q_DISABLE_COPY( QskSkinnable )
 
@@ -286,6 +312,12 @@ class QSK_EXPORT QskSkinnable
     friend class QskSkinStateChanger;
     void replaceSkinStates( QskAspect::States, int sampleIndex = -1 );
 
+    friend class QskSkinlet;
+    bool hasDirtySamples() const;
+    void resetDirtySamples() const;
+    QskHashValue swapSeriesHash( QskAspect::Subcontrol, QskHashValue ) const;
+    QskSampleIndex& sampleIndex( QskAspect::Subcontrol ) const;
+
     class PrivateData;
     std::unique_ptr< PrivateData > m_data;
 };
@@ -83,6 +83,16 @@ const QskTabBar* QskTabView::tabBar() const
     return m_data->tabBar;
 }
 
+QskStackBox* QskTabView::stackBox()
+{
+    return m_data->stackBox;
+}
+
+const QskStackBox* QskTabView::stackBox() const
+{
+    return m_data->stackBox;
+}
+
 void QskTabView::setTabBarEdge( Qt::Edge edge )
 {
     m_data->tabBar->setEdge( edge );
@@ -125,6 +135,17 @@ int QskTabView::insertTab( int index, const QString& text, QQuickItem* page )
     return index;
 }
 
+int QskTabView::addTab( const QString& text, const QskPageLoader::Factory& factory )
+{
+    return insertTab( -1, text, factory );
+}
+
+int QskTabView::insertTab( int index,
+    const QString& text, const QskPageLoader::Factory& factory )
+{
+    return insertTab( index, text, new QskPageLoader( factory ) );
+}
+
 void QskTabView::removeTab( int index )
 {
     if ( index >= 0 && index < m_data->tabBar->count() )
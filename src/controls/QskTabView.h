@@ -8,9 +8,11 @@
 
 #include "QskControl.h"
 #include "QskNamespace.h"
+#include "QskPageLoader.h"
 
 class QskTabBar;
 class QskTabButton;
+class QskStackBox;
 
 class QSK_EXPORT QskTabView : public QskControl
 {
@@ -42,6 +44,10 @@ class QSK_EXPORT QskTabView : public QskControl
     const QskTabBar* tabBar() const;
     QskTabBar* tabBar();
 
+    // the policies for on demand pages, see QskStackBox::setPageCacheLimit
+    const QskStackBox* stackBox() const;
+    QskStackBox* stackBox();
+
     void setTabBarEdge( Qt::Edge );
     Qt::Edge tabBarEdge() const;
 
@@ -53,6 +59,10 @@ class QSK_EXPORT QskTabView : public QskControl
     Q_INVOKABLE int addTab( const QString&, QQuickItem* );
     Q_INVOKABLE int insertTab( int index, const QString&, QQuickItem* );
 
+    // the page is created, when the tab gets selected for the first time
+    int addTab( const QString&, const QskPageLoader::Factory& );
+    int insertTab( int index, const QString&, const QskPageLoader::Factory& );
+
     Q_INVOKABLE void removeTab( int index );
     Q_INVOKABLE void clear( bool autoDelete = false );
 
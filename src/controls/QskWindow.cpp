@@ -6,6 +6,8 @@
 #include "QskWindow.h"
 #include "QskControl.h"
 #include "QskEvent.h"
+#include "QskFrameProfiler.h"
+#include "QskMaterialPrewarmer.h"
 #include "QskQuick.h"
 #include "QskSetup.h"
 #include "QskSkin.h"
@@ -710,6 +712,82 @@ QskSkin* QskWindow::skin() const
     return d_func()->skin;
 }
 
+void QskWindow::setFrameProfilingEnabled( bool on )
+{
+    auto profiler = QskFrameProfiler::profiler( this );
+
+    if ( on )
+    {
+        if ( profiler == nullptr )
+            ( void ) new QskFrameProfiler( this );
+    }
+    else if ( profiler )
+    {
+        class DeleteJob final : public QRunnable
+        {
+          public:
+            DeleteJob( QskFrameProfiler* profiler )
+                : m_profiler( profiler )
+            {
+            }
+
+            ~DeleteJob() override
+            {
+                /*
+                    Also called, when the job is discarded, because the
+                    window is not exposed. Then nothing is rendered and
+                    we can delete the profiler as well.
+
+                    We might be on the scene graph thread, where the
+                    QPointer must not be dereferenced. So the deletion
+                    is handed over to the GUI thread.
+                 */
+                QMetaObject::invokeMethod( QCoreApplication::instance(),
+                    [ profiler = m_profiler ] { delete profiler.data(); },
+                    Qt::QueuedConnection );
+            }
+
+            void run() override
+            {
+                // the scene graph thread is done with the profiler
+            }
+
+          private:
+            QPointer< QskFrameProfiler > m_profiler;
+        };
+
+        /*
+            The slots of the profiler are connected directly to the
+            signals of the scene graph thread, where they might be running
+            right now. So we stop the recording and delete the profiler
+            after the scene graph thread has finished the current frame.
+         */
+        profiler->detach();
+        scheduleRenderJob( new DeleteJob( profiler ), NoStage );
+    }
+}
+
+bool QskWindow::isFrameProfilingEnabled() const
+{
+    return QskFrameProfiler::profiler( this ) != nullptr;
+}
+
+QskFrameProfiler* QskWindow::frameProfiler() const
+{
+    return QskFrameProfiler::profiler( this );
+}
+
+QskMaterialPrewarmer* QskWindow::prewarmMaterials()
+{
+    auto prewarmer = findChild< QskMaterialPrewarmer* >( QString(), Qt::FindDirectChildrenOnly );
+    if ( prewarmer == nullptr )
+        prewarmer = new QskMaterialPrewarmer( this );
+
+    prewarmer->start();
+
+    return prewarmer;
+}
+
 QskSkin* qskEffectiveSkin( const QQuickWindow* window )
 {
     if ( auto w = qobject_cast< const QskWindow* >( window ) )
@@ -12,6 +12,8 @@
 class QskWindowPrivate;
 class QskObjectAttributes;
 class QskSkin;
+class QskFrameProfiler;
+class QskMaterialPrewarmer;
 
 class QSK_EXPORT QskWindow : public QQuickWindow
 {
@@ -75,6 +77,18 @@ class QSK_EXPORT QskWindow : public QQuickWindow
     void setSkin( const QString& );
     QskSkin* skin() const;
 
+    // recording the timing of the frames: s.a QskFrameProfiler
+    void setFrameProfilingEnabled( bool );
+    bool isFrameProfilingEnabled() const;
+
+    QskFrameProfiler* frameProfiler() const;
+
+    /*
+        Building the pipelines of all QSkinny materials in advance,
+        f.e. during startup: s.a QskMaterialPrewarmer
+     */
+    QskMaterialPrewarmer* prewarmMaterials();
+
   Q_SIGNALS:
     void localeChanged( const QLocale& );
     void autoLayoutChildrenChanged();
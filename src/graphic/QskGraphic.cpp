@@ -664,11 +664,11 @@ void QskGraphic::render( QPainter* painter, const QRectF& rect,
     render( painter, rect, QskColorFilter(), aspectRatioMode );
 }
 
-void QskGraphic::render( QPainter* painter, const QRectF& rect,
-    const QskColorFilter& colorFilter, Qt::AspectRatioMode aspectRatioMode ) const
+QTransform QskGraphic::renderTransform( const QRectF& rect,
+    Qt::AspectRatioMode aspectRatioMode ) const
 {
     if ( isEmpty() || rect.isEmpty() )
-        return;
+        return QTransform();
 
     qreal sx = 1.0;
     qreal sy = 1.0;
@@ -715,6 +715,18 @@ void QskGraphic::render( QPainter* painter, const QRectF& rect,
     tr.scale( sx, sy );
     tr.translate( -br.x(), -br.y() );
 
+    return tr;
+}
+
+void QskGraphic::render( QPainter* painter, const QRectF& rect,
+    const QskColorFilter& colorFilter, Qt::AspectRatioMode aspectRatioMode ) const
+{
+    if ( isEmpty() || rect.isEmpty() )
+        return;
+
+    const bool scalePens = !( m_data->renderHints & RenderPensUnscaled );
+    const auto tr = renderTransform( rect, aspectRatioMode );
+
     const auto transform = painter->transform();
 
     painter->setTransform( tr, true );
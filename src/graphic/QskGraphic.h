@@ -86,6 +86,10 @@ class QSK_EXPORT QskGraphic : public QPaintDevice
     void render( QPainter*, const QRectF&, const QskColorFilter&,
         Qt::AspectRatioMode = Qt::IgnoreAspectRatio ) const;
 
+    // the transformation, that is applied, when rendering into a rectangle
+    QTransform renderTransform( const QRectF&,
+        Qt::AspectRatioMode = Qt::IgnoreAspectRatio ) const;
+
     QPixmap toPixmap( qreal devicePixelRatio = 0.0 ) const;
 
     QPixmap toPixmap( const QSize&,
@@ -0,0 +1,446 @@
+/******************************************************************************
+ * QSkinny - Copyright (C) The authors
+ *           SPDX-License-Identifier: BSD-3-Clause
+ *****************************************************************************/
+
+#include "QskGraphicDiskCache.h"
+#include "QskColorFilter.h"
+#include "QskGraphic.h"
+#include "QskGraphicIO.h"
+
+#include <qatomic.h>
+#include <qbytearray.h>
+#include <qcryptographichash.h>
+#include <qdatastream.h>
+#include <qdatetime.h>
+#include <qdir.h>
+#include <qfile.h>
+#include <qglobalstatic.h>
+#include <qhash.h>
+#include <qimage.h>
+#include <qmutex.h>
+#include <qpainter.h>
+#include <qsavefile.h>
+#include <qthreadpool.h>
+
+#include <cstring>
+
+namespace
+{
+    /*
+        The layout of the files: the header followed by the pixels,
+        as they are found in QImage::constBits().
+     */
+    class FileHeader
+    {
+      public:
+        quint32 magicNumber;
+        quint32 version;
+
+        qint32 width;
+        qint32 height;
+        qint32 bytesPerLine;
+        qint32 format;
+
+        // keeping the pixels 16 byte aligned
+        quint64 reserved;
+    };
+
+    static_assert( sizeof( FileHeader ) == 32, "Unexpected padding" );
+
+    const quint32 qskMagicNumber = 0x51534b49; // "QSKI"
+
+    // to be increased, whenever the output of the rasterization changes
+    const quint32 qskFormatVersion = 1;
+
+    const auto qskImageFormat = QImage::Format_RGBA8888_Premultiplied;
+
+    const char qskFileSuffix[] = ".qski";
+
+    class Cache
+    {
+      public:
+        Cache()
+        {
+            const auto dir = qEnvironmentVariable( "QSK_GRAPHIC_DISK_CACHE" );
+            if ( !dir.isEmpty() && QDir().mkpath( dir ) )
+                directory = dir;
+
+            // one thread is enough for writing the files
+            threadPool.setMaxThreadCount( 1 );
+        }
+
+        QMutex mutex;
+
+        QString directory;
+        qint64 maximumSize = 32 * 1024 * 1024;
+
+        // the size of all files in the directory, -1: unknown
+        qint64 size = -1;
+
+        // digests of the graphics, indexed by QskGraphic::modificationId()
+        QHash< quint64, QByteArray > digests;
+
+        // writing files off the render thread
+        QThreadPool threadPool;
+
+        QAtomicInteger< quint64 > hitCount;
+        QAtomicInteger< quint64 > missCount;
+    };
+}
+
+Q_GLOBAL_STATIC( Cache, qskCache )
+
+static QByteArray qskGraphicDigest( const QskGraphic& graphic )
+{
+    /*
+        QskGraphic::hash() is based on modification counters, that
+        are not stable between different runs of the application.
+        So we need to calculate a digest from the commands, what is
+        done only once for each graphic.
+     */
+    const auto id = graphic.modificationId();
+
+    auto cache = qskCache();
+
+    {
+        QMutexLocker locker( &cache->mutex );
+
+        const auto it = cache->digests.constFind( id );
+        if ( it != cache->digests.constEnd() )
+            return it.value();
+    }
+
+    QByteArray data;
+    QskGraphicIO::write( graphic, data );
+
+    const auto digest = QCryptographicHash::hash( data, QCryptographicHash::Sha1 );
+
+    QMutexLocker locker( &cache->mutex );
+
+    if ( cache->digests.size() >= 512 )
+        cache->digests.clear();
+
+    cache->digests.insert( id, digest );
+
+    return digest;
+}
+
+static QString qskFileName( const QByteArray& digest, const QskGraphic& graphic,
+    const QskColorFilter& colorFilter, const QSize& size, qreal devicePixelRatio )
+{
+    QByteArray parameters;
+
+    {
+        QDataStream stream( &parameters, QIODevice::WriteOnly );
+
+        stream << qskFormatVersion << quint32( QT_VERSION );
+        stream << quint32( graphic.renderHints() );
+        stream << size << devicePixelRatio;
+
+        for ( const auto& substitution : colorFilter.substitutions() )
+            stream << substitution.first << substitution.second;
+    }
+
+    QCryptographicHash hash( QCryptographicHash::Sha1 );
+    hash.addData( digest );
+    hash.addData( parameters );
+
+    return QString::fromLatin1( hash.result().toHex() ) + QLatin1String( qskFileSuffix );
+}
+
+static QImage qskRenderImage( const QskGraphic& graphic,
+    const QskColorFilter& colorFilter, const QSize& size, qreal devicePixelRatio )
+{
+    // see QskPaintedNode::createImage
+
+    QImage image( size, qskImageFormat );
+    image.fill( Qt::transparent );
+
+    QPainter painter( &image );
+    painter.scale( devicePixelRatio, devicePixelRatio );
+
+    const QRectF rect( 0.0, 0.0,
+        size.width() / devicePixelRatio, size.height() / devicePixelRatio );
+
+    graphic.render( &painter, rect, colorFilter, Qt::IgnoreAspectRatio );
+
+    painter.end();
+
+    return image;
+}
+
+static void qskUnmapFile( void* file )
+{
+    // closing the file also unmaps the memory
+    delete static_cast< QFile* >( file );
+}
+
+static QImage qskLoadImage( const QString& path, const QSize& size )
+{
+    auto file = new QFile( path );
+    if ( !file->open( QIODevice::ReadOnly ) )
+    {
+        delete file;
+        return QImage();
+    }
+
+    const auto fileSize = file->size();
+
+    const uchar* data = nullptr;
+    if ( fileSize > qint64( sizeof( FileHeader ) ) )
+        data = file->map( 0, fileSize );
+
+    if ( data )
+    {
+        FileHeader header;
+        std::memcpy( &header, data, sizeof( header ) );
+
+        const bool isValid = ( header.magicNumber == qskMagicNumber )
+            && ( header.version == qskFormatVersion )
+            && ( header.format == qskImageFormat )
+            && ( header.width == size.width() ) && ( header.height == size.height() )
+            && ( qint64( header.bytesPerLine ) * header.height
+                + qint64( sizeof( FileHeader ) ) == fileSize );
+
+        if ( isValid )
+        {
+            // the image data remains in the mapped memory
+            return QImage( data + sizeof( FileHeader ), header.width, header.height,
+                header.bytesPerLine, qskImageFormat, qskUnmapFile, file );
+        }
+    }
+
+    // corrupted or outdated
+    file->remove();
+    delete file;
+
+    return QImage();
+}
+
+static qint64 qskStoreImage( const QString& path, const QImage& image )
+{
+    FileHeader header;
+    std::memset( &header, 0, sizeof( header ) );
+
+    header.magicNumber = qskMagicNumber;
+    header.version = qskFormatVersion;
+    header.width = image.width();
+    header.height = image.height();
+    header.bytesPerLine = image.bytesPerLine();
+    header.format = image.format();
+
+    QSaveFile file( path );
+    if ( !file.open( QIODevice::WriteOnly ) )
+        return -1;
+
+    file.write( reinterpret_cast< const char* >( &header ), sizeof( header ) );
+    file.write( reinterpret_cast< const char* >( image.constBits() ), image.sizeInBytes() );
+
+    if ( !file.commit() )
+        return -1;
+
+    return sizeof( header ) + image.sizeInBytes();
+}
+
+static void qskTouchFile( const QString& path )
+{
+    /*
+        The files are removed by their modification time. Updating it,
+        whenever a file is used, makes the cache a LRU cache.
+     */
+    QFile file( path );
+    if ( file.open( QIODevice::Append ) )
+        file.setFileTime( QDateTime::currentDateTime(), QFileDevice::FileModificationTime );
+}
+
+static QFileInfoList qskCacheFiles( const QString& directory, QDir::SortFlags sortFlags )
+{
+    const QStringList filters { QLatin1Char( '*' ) + QLatin1String( qskFileSuffix ) };
+    return QDir( directory ).entryInfoList( filters, QDir::Files, sortFlags );
+}
+
+static void qskAddCacheSize( Cache* cache, qint64 size )
+{
+    // the mutex is locked by the caller
+
+    if ( cache->size < 0 )
+    {
+        cache->size = 0;
+
+        for ( const auto& info : qskCacheFiles( cache->directory, QDir::NoSort ) )
+            cache->size += info.size();
+    }
+    else
+    {
+        cache->size += size;
+    }
+
+    if ( cache->size <= cache->maximumSize )
+        return;
+
+    // removing the least recently used files, until we are below 75% of the limit
+
+    const auto limit = cache->maximumSize / 4 * 3;
+
+    auto files = qskCacheFiles( cache->directory, QDir::Time | QDir::Reversed );
+
+    for ( const auto& info : std::as_const( files ) )
+    {
+        if ( cache->size <= limit )
+            break;
+
+        if ( QFile::remove( info.absoluteFilePath() ) )
+            cache->size -= info.size();
+    }
+}
+
+void QskGraphicDiskCache::setDirectory( const QString& directory )
+{
+    if ( !directory.isEmpty() )
+        QDir().mkpath( directory );
+
+    auto cache = qskCache();
+
+    QMutexLocker locker( &cache->mutex );
+
+    if ( directory != cache->directory )
+    {
+        cache->directory = directory;
+        cache->size = -1;
+    }
+}
+
+QString QskGraphicDiskCache::directory()
+{
+    auto cache = qskCache();
+
+    QMutexLocker locker( &cache->mutex );
+    return cache->directory;
+}
+
+bool QskGraphicDiskCache::isEnabled()
+{
+    return !directory().isEmpty();
+}
+
+void QskGraphicDiskCache::setMaximumSize( qint64 size )
+{
+    auto cache = qskCache();
+
+    QMutexLocker locker( &cache->mutex );
+    cache->maximumSize = qMax( size, qint64( 0 ) );
+
+    if ( !cache->directory.isEmpty() )
+        qskAddCacheSize( cache, 0 );
+}
+
+qint64 QskGraphicDiskCache::maximumSize()
+{
+    auto cache = qskCache();
+
+    QMutexLocker locker( &cache->mutex );
+    return cache->maximumSize;
+}
+
+void QskGraphicDiskCache::clear()
+{
+    auto cache = qskCache();
+
+    // pending writes would refill the cache
+    cache->threadPool.clear();
+    cache->threadPool.waitForDone();
+
+    QMutexLocker locker( &cache->mutex );
+
+    if ( !cache->directory.isEmpty() )
+    {
+        for ( const auto& info : qskCacheFiles( cache->directory, QDir::NoSort ) )
+            QFile::remove( info.absoluteFilePath() );
+    }
+
+    cache->size = 0;
+}
+
+QImage QskGraphicDiskCache::image( const QskGraphic& graphic,
+    const QskColorFilter& colorFilter, const QSize& size, qreal devicePixelRatio )
+{
+    if ( graphic.isEmpty() || size.isEmpty() )
+        return QImage();
+
+    const auto directory = QskGraphicDiskCache::directory();
+
+    if ( directory.isEmpty() || ( graphic.commandTypes() & QskGraphic::RasterData ) )
+        return qskRenderImage( graphic, colorFilter, size, devicePixelRatio );
+
+    /*
+        This function is usually called from the render thread. Calculating
+        the digest of a graphic is much cheaper than rendering it, so it is
+        done here - otherwise we would never find an image, when the
+        application is started. Only writing the files is done in a
+        worker thread.
+     */
+
+    auto cache = qskCache();
+
+    const auto path = directory + QLatin1Char( '/' ) + qskFileName(
+        qskGraphicDigest( graphic ), graphic, colorFilter, size, devicePixelRatio );
+
+    {
+        const auto image = qskLoadImage( path, size );
+        if ( !image.isNull() )
+        {
+            cache->hitCount.fetchAndAddRelaxed( 1 );
+            cache->threadPool.start( [ path ] { qskTouchFile( path ); } );
+
+            return image;
+        }
+    }
+
+    cache->missCount.fetchAndAddRelaxed( 1 );
+
+    const auto image = qskRenderImage( graphic, colorFilter, size, devicePixelRatio );
+
+    auto store = [ path, image ]
+    {
+        if ( QFile::exists( path ) )
+            return;
+
+        const auto fileSize = qskStoreImage( path, image );
+        if ( fileSize > 0 )
+        {
+            auto cache = qskCache();
+
+            QMutexLocker locker( &cache->mutex );
+            qskAddCacheSize( cache, fileSize );
+        }
+    };
+
+    cache->threadPool.start( store );
+
+    return image;
+}
+
+void QskGraphicDiskCache::waitForDone()
+{
+    qskCache()->threadPool.waitForDone();
+}
+
+QskGraphicDiskCache::Statistics QskGraphicDiskCache::statistics()
+{
+    auto cache = qskCache();
+
+    Statistics statistics;
+    statistics.hitCount = cache->hitCount.loadRelaxed();
+    statistics.missCount = cache->missCount.loadRelaxed();
+
+    return statistics;
+}
+
+void QskGraphicDiskCache::resetStatistics()
+{
+    auto cache = qskCache();
+
+    cache->hitCount.storeRelaxed( 0 );
+    cache->missCount.storeRelaxed( 0 );
+}
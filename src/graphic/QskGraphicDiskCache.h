@@ -0,0 +1,69 @@
+/******************************************************************************
+ * QSkinny - Copyright (C) The authors
+ *           SPDX-License-Identifier: BSD-3-Clause
+ *****************************************************************************/
+
+#ifndef QSK_GRAPHIC_DISK_CACHE_H
+#define QSK_GRAPHIC_DISK_CACHE_H
+
+#include "QskGlobal.h"
+
+class QskGraphic;
+class QskColorFilter;
+class QImage;
+class QSize;
+class QString;
+
+/*
+    A persistent cache of rasterized graphics, that avoids having to
+    render the same icons again, when the application is restarted.
+
+    The images are stored as raw pixel data, that is mapped into memory
+    and uploaded to the textures without any conversion. The cache is keyed by
+    the content of the graphic, the color filter, the size and the
+    device pixel ratio. It is populated lazily, when the textures are
+    created, or in advance by calling image() from a warm-up tool
+    with the sizes in use.
+
+    The cache is disabled by default. It can be enabled by setting a
+    directory or by the environment variable QSK_GRAPHIC_DISK_CACHE.
+
+    All functions are thread safe.
+ */
+namespace QskGraphicDiskCache
+{
+    // an empty path disables the cache
+    QSK_EXPORT void setDirectory( const QString& );
+    QSK_EXPORT QString directory();
+
+    QSK_EXPORT bool isEnabled();
+
+    // the limit in bytes, the least recently used images are removed beyond
+    QSK_EXPORT void setMaximumSize( qint64 );
+    QSK_EXPORT qint64 maximumSize();
+
+    QSK_EXPORT void clear();
+
+    /*
+        The image from the cache. When not being available or the cache
+        is disabled the graphic is rendered - and stored in a worker thread,
+        when enabled. Graphics with raster data are never stored.
+     */
+    QSK_EXPORT QImage image( const QskGraphic&, const QskColorFilter&,
+        const QSize&, qreal devicePixelRatio );
+
+    // waiting until all pending images have been stored
+    QSK_EXPORT void waitForDone();
+
+    class Statistics
+    {
+      public:
+        quint64 hitCount = 0;  // images, that have been loaded from the cache
+        quint64 missCount = 0; // images, that had to be rendered
+    };
+
+    QSK_EXPORT Statistics statistics();
+    QSK_EXPORT void resetStatistics();
+}
+
+#endif
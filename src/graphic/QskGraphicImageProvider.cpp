@@ -8,6 +8,8 @@
 #include "QskGraphicProvider.h"
 #include "QskGraphicTextureFactory.h"
 
+#include <qrunnable.h>
+
 static inline QSize qskGraphicSize( const QskGraphic& graphic,
     const QSize& requestedSize, QSize* result )
 {
@@ -44,6 +46,55 @@ static inline QSize qskGraphicSize( const QskGraphic& graphic,
     return ret;
 }
 
+namespace
+{
+    class ImageResponse final : public QQuickImageResponse, public QRunnable
+    {
+      public:
+        ImageResponse( const QString& providerId,
+                const QString& id, const QSize& requestedSize )
+            : m_providerId( providerId )
+            , m_id( id )
+            , m_requestedSize( requestedSize )
+        {
+            // the response is deleted by the QML engine
+            setAutoDelete( false );
+        }
+
+        QQuickTextureFactory* textureFactory() const override
+        {
+            return QQuickTextureFactory::textureFactoryForImage( m_image );
+        }
+
+        void run() override
+        {
+            if ( m_requestedSize.width() == 0 || m_requestedSize.height() == 0 )
+            {
+                // see QskGraphicImageProvider::requestImage
+                m_image = QImage( 1, 1, QImage::Format_ARGB32_Premultiplied );
+            }
+            else if ( auto provider = Qsk::graphicProvider( m_providerId ) )
+            {
+                const auto graphic = provider->requestGraphic( m_id );
+                if ( !graphic.isNull() )
+                {
+                    const auto sz = qskGraphicSize( graphic, m_requestedSize, nullptr );
+                    m_image = graphic.toImage( sz, Qt::KeepAspectRatio );
+                }
+            }
+
+            Q_EMIT finished();
+        }
+
+      private:
+        const QString m_providerId;
+        const QString m_id;
+        const QSize m_requestedSize;
+
+        QImage m_image;
+    };
+}
+
 QskGraphicImageProvider::QskGraphicImageProvider(
         const QString& providerId, ImageType type )
     : QQuickImageProvider( type )
@@ -76,11 +127,11 @@ QImage QskGraphicImageProvider::requestImage(
     }
 
     const auto graphic = requestGraphic( id );
-    if ( graphic == nullptr )
+    if ( graphic.isNull() )
         return QImage();
 
-    const QSize sz = qskGraphicSize( *graphic, requestedSize, size );
-    return graphic->toImage( sz, Qt::KeepAspectRatio );
+    const QSize sz = qskGraphicSize( graphic, requestedSize, size );
+    return graphic.toImage( sz, Qt::KeepAspectRatio );
 }
 
 QPixmap QskGraphicImageProvider::requestPixmap(
@@ -97,11 +148,11 @@ QPixmap QskGraphicImageProvider::requestPixmap(
     }
 
     const auto graphic = requestGraphic( id );
-    if ( graphic == nullptr )
+    if ( graphic.isNull() )
         return QPixmap();
 
-    const QSize sz = qskGraphicSize( *graphic, requestedSize, size );
-    return graphic->toPixmap( sz, Qt::KeepAspectRatio );
+    const QSize sz = qskGraphicSize( graphic, requestedSize, size );
+    return graphic.toPixmap( sz, Qt::KeepAspectRatio );
 }
 
 QQuickTextureFactory* QskGraphicImageProvider::requestTexture(
@@ -111,17 +162,41 @@ QQuickTextureFactory* QskGraphicImageProvider::requestTexture(
         return nullptr;
 
     const auto graphic = requestGraphic( id );
-    if ( graphic == nullptr )
+    if ( graphic.isNull() )
         return nullptr;
 
-    const QSize sz = qskGraphicSize( *graphic, requestedSize, size );
-    return new QskGraphicTextureFactory( *graphic, sz );
+    const QSize sz = qskGraphicSize( graphic, requestedSize, size );
+    return new QskGraphicTextureFactory( graphic, sz );
 }
 
-const QskGraphic* QskGraphicImageProvider::requestGraphic( const QString& id ) const
+QskGraphic QskGraphicImageProvider::requestGraphic( const QString& id ) const
 {
     if ( auto graphicProvider = Qsk::graphicProvider( m_providerId ) )
         return graphicProvider->requestGraphic( id );
 
-    return nullptr;
+    return QskGraphic();
+}
+
+QskGraphicAsyncImageProvider::QskGraphicAsyncImageProvider( const QString& providerId )
+    : m_providerId( providerId )
+{
+}
+
+QskGraphicAsyncImageProvider::~QskGraphicAsyncImageProvider()
+{
+    m_threadPool.waitForDone();
+}
+
+QString QskGraphicAsyncImageProvider::graphicProviderId() const
+{
+    return m_providerId;
+}
+
+QQuickImageResponse* QskGraphicAsyncImageProvider::requestImageResponse(
+    const QString& id, const QSize& requestedSize )
+{
+    auto response = new ImageResponse( m_providerId, id, requestedSize );
+    m_threadPool.start( response );
+
+    return response;
 }
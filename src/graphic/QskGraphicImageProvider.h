@@ -7,7 +7,9 @@
 #define QSK_GRAPHIC_IMAGE_PROVIDER_H
 
 #include "QskGlobal.h"
+
 #include <qquickimageprovider.h>
+#include <qthreadpool.h>
 
 class QskGraphic;
 
@@ -29,7 +31,7 @@ class QSK_EXPORT QskGraphicImageProvider : public QQuickImageProvider
     QString graphicProviderId() const;
 
   protected:
-    const QskGraphic* requestGraphic( const QString& id ) const;
+    QskGraphic requestGraphic( const QString& id ) const;
 
   private:
     Q_DISABLE_COPY( QskGraphicImageProvider )
@@ -37,4 +39,28 @@ class QSK_EXPORT QskGraphicImageProvider : public QQuickImageProvider
     const QString m_providerId;
 };
 
+/*
+    QskGraphicAsyncImageProvider loads and renders the graphics
+    in worker threads, without blocking the loader of the QML engine.
+    It can only be used with graphic providers, that have a thread safe
+    implementation of QskGraphicProvider::loadGraphic().
+ */
+class QSK_EXPORT QskGraphicAsyncImageProvider : public QQuickAsyncImageProvider
+{
+  public:
+    QskGraphicAsyncImageProvider( const QString& providerId );
+    ~QskGraphicAsyncImageProvider() override;
+
+    QQuickImageResponse* requestImageResponse(
+        const QString& id, const QSize& requestedSize ) override;
+
+    QString graphicProviderId() const;
+
+  private:
+    Q_DISABLE_COPY( QskGraphicAsyncImageProvider )
+
+    const QString m_providerId;
+    QThreadPool m_threadPool;
+};
+
 #endif
@@ -5,41 +5,129 @@
 
 #include "QskGraphicProvider.h"
 #include "QskGraphic.h"
+#include "QskPainterCommand.h"
 #include "QskSetup.h"
 
 #include <qmutex.h>
 #include <qcache.h>
 #include <qdebug.h>
+#include <qhash.h>
+#include <qpointer.h>
+#include <qthread.h>
+#include <qthreadpool.h>
 #include <qurl.h>
+#include <qvector.h>
+
+#include <limits>
+
+static int qskGraphicCost( const QskGraphic& graphic )
+{
+    // an estimation of the memory, that is needed for the graphic
+
+    const auto& commands = graphic.commands();
+
+    qint64 cost = sizeof( QskGraphic )
+        + commands.size() * sizeof( QskPainterCommand );
+
+    for ( const auto& command : commands )
+    {
+        switch ( command.type() )
+        {
+            case QskPainterCommand::Path:
+            {
+                cost += command.path()->elementCount()
+                    * sizeof( QPainterPath::Element );
+                break;
+            }
+            case QskPainterCommand::Pixmap:
+            {
+                const auto& pixmap = command.pixmapData()->pixmap;
+                cost += sizeof( QskPainterCommand::PixmapData )
+                    + qint64( pixmap.width() ) * pixmap.height() * pixmap.depth() / 8;
+                break;
+            }
+            case QskPainterCommand::Image:
+            {
+                cost += sizeof( QskPainterCommand::ImageData )
+                    + command.imageData()->image.sizeInBytes();
+                break;
+            }
+            case QskPainterCommand::State:
+            {
+                cost += sizeof( QskPainterCommand::StateData );
+                break;
+            }
+            default:
+                break;
+        }
+    }
+
+    return static_cast< int >( qMin( cost, qint64( std::numeric_limits< int >::max() ) ) );
+}
+
+namespace
+{
+    class Request
+    {
+      public:
+        inline bool isValid() const
+        {
+            return callback && ( context || !hasContext );
+        }
+
+        QPointer< const QObject > context;
+        bool hasContext;
+
+        QskGraphicProvider::Callback callback;
+    };
+}
 
 class QskGraphicProvider::PrivateData
 {
   public:
-    // caching of graphics
+    // caching of graphics, the cost is in bytes
     QCache< QString, const QskGraphic > cache;
     QMutex mutex;
+
+    // ids, that are currently loaded
+    QHash< QString, QVector< Request > > pendingRequests;
+
+    QThreadPool threadPool;
+    bool threadedLoading = false;
 };
 
 QskGraphicProvider::QskGraphicProvider( QObject* parent )
     : QObject( parent )
     , m_data( new PrivateData() )
 {
+    m_data->cache.setMaxCost( 8 * 1024 * 1024 );
+
+    // keeping one core for the GUI thread
+    m_data->threadPool.setMaxThreadCount(
+        qMax( 1, QThread::idealThreadCount() - 1 ) );
 }
 
 QskGraphicProvider::~QskGraphicProvider()
 {
+    if ( m_data->threadPool.activeThreadCount() > 0 )
+    {
+        qWarning() << "QskGraphicProvider: derived classes with threaded"
+            << "loading need to call abortPendingRequests() in their destructor";
+    }
+
+    abortPendingRequests();
 }
 
-void QskGraphicProvider::setCacheSize( int size )
+void QskGraphicProvider::setMaxCacheCost( int cost )
 {
-    if ( size < 0 )
-        size = 0;
+    if ( cost < 0 )
+        cost = 0;
 
     QMutexLocker locker( &m_data->mutex );
-    m_data->cache.setMaxCost( size );
+    m_data->cache.setMaxCost( cost );
 }
 
-int QskGraphicProvider::cacheSize() const
+int QskGraphicProvider::maxCacheCost() const
 {
     QMutexLocker locker( &m_data->mutex );
     return m_data->cache.maxCost();
@@ -51,42 +139,165 @@ void QskGraphicProvider::clearCache()
     m_data->cache.clear();
 }
 
-const QskGraphic* QskGraphicProvider::requestGraphic( const QString& id ) const
+QskGraphic QskGraphicProvider::requestGraphic( const QString& id ) const
 {
-    const QskGraphic* graphic = nullptr;
-
     {
         QMutexLocker locker( &m_data->mutex );
-        graphic = m_data->cache.object( id );
+
+        if ( auto graphic = m_data->cache.object( id ) )
+            return *graphic;
     }
 
+    const auto graphic = loadGraphic( id );
     if ( graphic == nullptr )
     {
-        graphic = loadGraphic( id );
+        qWarning() << "QskGraphicProvider: can't load" << id;
+        return QskGraphic();
+    }
 
-        if ( graphic == nullptr )
-        {
-            qWarning() << "QskGraphicProvider: can't load" << id;
-            return nullptr;
-        }
+    /*
+        Returning a copy, as the cached graphic might be replaced
+        by another thread at any time. QskGraphic is implicitly shared,
+        so this is cheap.
+     */
+    const QskGraphic loaded = *graphic;
+
+    QMutexLocker locker( &m_data->mutex );
+
+    if ( auto cached = m_data->cache.object( id ) )
+    {
+        // loaded in parallel by another thread
+        delete graphic;
+        return *cached;
+    }
+
+    // QCache deletes graphics immediately, that exceed the limit
+    m_data->cache.insert( id, graphic, qskGraphicCost( loaded ) );
+
+    return loaded;
+}
+
+void QskGraphicProvider::setThreadedLoading( bool on )
+{
+    QMutexLocker locker( &m_data->mutex );
+    m_data->threadedLoading = on;
+}
+
+bool QskGraphicProvider::isThreadedLoading() const
+{
+    QMutexLocker locker( &m_data->mutex );
+    return m_data->threadedLoading;
+}
+
+void QskGraphicProvider::requestGraphicAsync( const QString& id,
+    const QObject* context, const Callback& callback )
+{
+    Q_ASSERT( context == nullptr || context->thread() == thread() );
+
+    QMutexLocker locker( &m_data->mutex );
+
+    const bool isPending = m_data->pendingRequests.contains( id );
+    m_data->pendingRequests[ id ] += Request { context, context != nullptr, callback };
+
+    if ( isPending )
+        return;
+
+    if ( auto graphic = m_data->cache.object( id ) )
+    {
+        const QskGraphic cached = *graphic;
+
+        QMetaObject::invokeMethod( this,
+            [ this, id, cached ] { deliverGraphic( id, cached ); },
+            Qt::QueuedConnection );
+    }
+    else
+    {
+        startLoading( id );
+    }
+}
+
+void QskGraphicProvider::prefetch( const QStringList& ids )
+{
+    QMutexLocker locker( &m_data->mutex );
+
+    for ( const auto& id : ids )
+    {
+        if ( m_data->pendingRequests.contains( id ) || m_data->cache.contains( id ) )
+            continue;
+
+        m_data->pendingRequests.insert( id, {} );
+        startLoading( id );
+    }
+}
+
+void QskGraphicProvider::abortPendingRequests()
+{
+    m_data->threadPool.clear();
+    m_data->threadPool.waitForDone();
+
+    QMutexLocker locker( &m_data->mutex );
+    m_data->pendingRequests.clear();
+}
 
+void QskGraphicProvider::startLoading( const QString& id )
+{
+    // the mutex is locked by the caller
+
+    if ( m_data->threadedLoading )
+    {
+        auto load = [ this, id ]
         {
-            QMutexLocker locker( &m_data->mutex );
+            const auto graphic = requestGraphic( id );
 
-            if( auto cached = m_data->cache.object( id ) )
-            {
-                delete graphic;
-                graphic = cached;
-            }
-            else
-            {
-                const int cost = 1; // TODO ...
-                m_data->cache.insert( id, graphic, cost );
-            }
-        }
+            QMetaObject::invokeMethod( this,
+                [ this, id, graphic ] { deliverGraphic( id, graphic ); },
+                Qt::QueuedConnection );
+        };
+
+        m_data->threadPool.start( load );
+    }
+    else
+    {
+        QMetaObject::invokeMethod( this,
+            [ this, id ] { loadPendingGraphic( id ); },
+            Qt::QueuedConnection );
+    }
+}
+
+void QskGraphicProvider::loadPendingGraphic( const QString& id )
+{
+    {
+        QMutexLocker locker( &m_data->mutex );
+        if ( !m_data->pendingRequests.contains( id ) )
+            return; // aborted
     }
 
-    return graphic;
+    deliverGraphic( id, requestGraphic( id ) );
+}
+
+void QskGraphicProvider::deliverGraphic(
+    const QString& id, const QskGraphic& graphic )
+{
+    QVector< Request > requests;
+
+    {
+        QMutexLocker locker( &m_data->mutex );
+
+        auto it = m_data->pendingRequests.find( id );
+        if ( it == m_data->pendingRequests.end() )
+            return; // aborted
+
+        requests = it.value();
+        m_data->pendingRequests.erase( it );
+    }
+
+    for ( const auto& request : std::as_const( requests ) )
+    {
+        if ( request.isValid() )
+            request.callback( graphic );
+    }
+
+    Q_EMIT graphicLoaded( id );
 }
 
 void Qsk::addGraphicProvider(
@@ -120,12 +331,10 @@ QskGraphic Qsk::loadGraphic( const QUrl& url )
 
     const QString providerId = url.host();
 
-    const QskGraphic* graphic = nullptr;
-
     if ( const auto provider = qskSetup->graphicProvider( providerId ) )
-        graphic = provider->requestGraphic( imageId );
+        return provider->requestGraphic( imageId );
 
-    return graphic ? *graphic : nullGraphic;
+    return nullGraphic;
 }
 
 #include "moc_QskGraphicProvider.cpp"
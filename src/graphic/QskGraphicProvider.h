@@ -9,6 +9,9 @@
 #include "QskGlobal.h"
 
 #include <qobject.h>
+#include <qstringlist.h>
+
+#include <functional>
 #include <memory>
 
 class QskGraphic;
@@ -18,24 +21,68 @@ class QSK_EXPORT QskGraphicProvider : public QObject
 {
     Q_OBJECT
 
-    Q_PROPERTY( int cacheSize READ cacheSize WRITE setCacheSize )
+    Q_PROPERTY( int maxCacheCost READ maxCacheCost WRITE setMaxCacheCost )
+    Q_PROPERTY( bool threadedLoading READ isThreadedLoading WRITE setThreadedLoading )
 
   public:
+    using Callback = std::function< void( const QskGraphic& ) >;
+
     QskGraphicProvider( QObject* parent = nullptr );
     ~QskGraphicProvider() override;
 
-    void setCacheSize( int );
-    int cacheSize() const;
+    /*
+        The cost of a graphic is an estimation of its memory in bytes
+        ( commands, paths and pixmap data ). The default limit is 8MB.
+     */
+    void setMaxCacheCost( int );
+    int maxCacheCost() const;
 
     void clearCache();
 
-    const QskGraphic* requestGraphic( const QString& id ) const;
+    // a null graphic, when loading has failed
+    QskGraphic requestGraphic( const QString& id ) const;
+
+    /*
+        By default asynchronous requests and prefetches are loaded
+        from the event loop of the provider thread. With threaded loading
+        they are loaded in worker threads, what requires:
+
+        - loadGraphic being thread safe
+        - derived classes calling abortPendingRequests() in their destructor,
+          as loadGraphic might be running, while the provider is destroyed
+     */
+    void setThreadedLoading( bool );
+    bool isThreadedLoading() const;
+
+    /*
+        The callback is always called asynchronously in the thread of
+        the provider, where the context has to live. It is skipped, when
+        the context has been deleted before. A null graphic is passed,
+        when loading has failed.
+     */
+    void requestGraphicAsync( const QString& id,
+        const QObject* context, const Callback& );
+
+    // warming up the cache, f.e before navigating to a page
+    void prefetch( const QStringList& ids );
+
+    // cancel pending requests and wait for the running ones
+    void abortPendingRequests();
+
+  Q_SIGNALS:
+    // sent in the thread of the provider after an async load
+    void graphicLoaded( const QString& id );
 
   protected:
     virtual const QskGraphic* loadGraphic( const QString& id ) const = 0;
 
     class PrivateData;
     std::unique_ptr< PrivateData > m_data;
+
+  private:
+    void startLoading( const QString& id );
+    void loadPendingGraphic( const QString& id );
+    void deliverGraphic( const QString& id, const QskGraphic& );
 };
 
 namespace Qsk
@@ -0,0 +1,167 @@
+/******************************************************************************
+ * QSkinny - Copyright (C) The authors
+ *           SPDX-License-Identifier: BSD-3-Clause
+ *****************************************************************************/
+
+#include "QskPageLoader.h"
+#include "QskMemoryStatistics.h"
+
+#include <qpointer.h>
+#include <qquickwindow.h>
+#include <qatomic.h>
+
+class QskPageLoader::PrivateData
+{
+  public:
+    Factory factory;
+    QPointer< QQuickItem > page;
+
+    QMetaObject::Connection syncConnection;
+
+    // written from the scene graph thread, while the GUI thread is blocked
+    QAtomicInteger< qint64 > cost = 0;
+    QAtomicInt isCostRequested = 1;
+};
+
+QskPageLoader::QskPageLoader( QQuickItem* parent )
+    : QskPageLoader( Factory(), parent )
+{
+}
+
+QskPageLoader::QskPageLoader( const Factory& factory, QQuickItem* parent )
+    : Inherited( parent )
+    , m_data( new PrivateData() )
+{
+    m_data->factory = factory;
+
+    setAutoLayoutChildren( true );
+    initSizePolicy( QskSizePolicy::Preferred, QskSizePolicy::Preferred );
+}
+
+QskPageLoader::~QskPageLoader()
+{
+    disconnect( m_data->syncConnection );
+}
+
+void QskPageLoader::setFactory( const Factory& factory )
+{
+    m_data->factory = factory;
+
+    if ( isVisible() && !isLoaded() )
+        load();
+}
+
+QskPageLoader::Factory QskPageLoader::factory() const
+{
+    return m_data->factory;
+}
+
+bool QskPageLoader::isLoaded() const
+{
+    return m_data->page != nullptr;
+}
+
+QQuickItem* QskPageLoader::page() const
+{
+    return m_data->page;
+}
+
+void QskPageLoader::load()
+{
+    if ( isLoaded() || !m_data->factory )
+        return;
+
+    auto page = m_data->factory();
+    if ( page == nullptr )
+        return;
+
+    page->setParent( this );
+    page->setParentItem( this );
+
+    m_data->page = page;
+    m_data->isCostRequested = 1;
+
+    resetImplicitSize();
+    polish();
+
+    Q_EMIT loadedChanged( true );
+}
+
+void QskPageLoader::unload()
+{
+    if ( !isLoaded() )
+        return;
+
+    auto page = m_data->page.data();
+    m_data->page = nullptr;
+    m_data->cost = 0;
+
+    if ( page->parent() == this )
+        delete page;
+    else
+        page->setParentItem( nullptr );
+
+    resetImplicitSize();
+
+    Q_EMIT loadedChanged( false );
+}
+
+qint64 QskPageLoader::cost() const
+{
+    if ( !isLoaded() )
+        return 0;
+
+    // refreshing the value with the next synchronization
+    m_data->isCostRequested = 1;
+
+    return m_data->cost;
+}
+
+void QskPageLoader::updateCost()
+{
+    /*
+        Called from QQuickWindow::afterSynchronizing: the nodes are up to
+        date and - with the threaded render loop - the GUI thread is blocked.
+     */
+    if ( !m_data->isCostRequested.testAndSetRelaxed( 1, 0 ) )
+        return;
+
+    qint64 cost = 0;
+
+    if ( const auto page = m_data->page.data() )
+    {
+        const QskMemoryStatistics statistics( page );
+        const auto nodeStatistics = statistics.totalNodeStatistics();
+
+        cost = nodeStatistics.vertexBytes + nodeStatistics.indexBytes
+            + nodeStatistics.textureBytes + statistics.totalHintStatistics().bytes;
+    }
+
+    m_data->cost = cost;
+}
+
+void QskPageLoader::itemChange(
+    QQuickItem::ItemChange change, const QQuickItem::ItemChangeData& value )
+{
+    Inherited::itemChange( change, value );
+
+    if ( change == QQuickItem::ItemVisibleHasChanged )
+    {
+        if ( value.boolValue )
+            load();
+    }
+    else if ( change == QQuickItem::ItemSceneChange )
+    {
+        disconnect( m_data->syncConnection );
+
+        if ( auto window = value.window )
+        {
+            m_data->syncConnection = connect( window, &QQuickWindow::afterSynchronizing,
+                this, [ this ] { updateCost(); }, Qt::DirectConnection );
+        }
+
+        m_data->isCostRequested = 1;
+    }
+}
+
+#include "moc_QskPageLoader.cpp"
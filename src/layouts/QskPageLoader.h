@@ -0,0 +1,72 @@
+/******************************************************************************
+ * QSkinny - Copyright (C) The authors
+ *           SPDX-License-Identifier: BSD-3-Clause
+ *****************************************************************************/
+
+#ifndef QSK_PAGE_LOADER_H
+#define QSK_PAGE_LOADER_H
+
+#include "QskControl.h"
+#include <functional>
+
+/*
+    QskPageLoader is a placeholder for a page, that is created from a factory
+    when the loader becomes visible for the first time. It can be inserted into
+    a QskStackBox, QskSwipeView or QskTabView like any other page:
+
+        tabView->addTab( "Settings",
+            new QskPageLoader( [] { return new SettingsPage(); } ) );
+
+    The page is a child of the loader, that is filling it. Unloading
+    destroys the page - f.e. according to the cache policy of QskStackBox.
+ */
+class QSK_EXPORT QskPageLoader : public QskControl
+{
+    Q_OBJECT
+
+    Q_PROPERTY( bool loaded READ isLoaded NOTIFY loadedChanged )
+
+    using Inherited = QskControl;
+
+  public:
+    using Factory = std::function< QQuickItem*() >;
+
+    QskPageLoader( QQuickItem* parent = nullptr );
+    QskPageLoader( const Factory&, QQuickItem* parent = nullptr );
+
+    ~QskPageLoader() override;
+
+    void setFactory( const Factory& );
+    Factory factory() const;
+
+    bool isLoaded() const;
+    QQuickItem* page() const;
+
+    /*
+        An estimation of the memory used by the page in bytes, that is
+        used for the memory budget of QskStackBox. The default implementation
+        returns the value, that has been collected by QskMemoryStatistics
+        for the nodes and local skin hints during the most recent scene graph
+        synchronization after the previous call. The nodes are never
+        inspected from the GUI thread.
+     */
+    virtual qint64 cost() const;
+
+  public Q_SLOTS:
+    void load();
+    void unload();
+
+  Q_SIGNALS:
+    void loadedChanged( bool );
+
+  protected:
+    void itemChange( ItemChange, const ItemChangeData& ) override;
+
+  private:
+    void updateCost();
+
+    class PrivateData;
+    std::unique_ptr< PrivateData > m_data;
+};
+
+#endif
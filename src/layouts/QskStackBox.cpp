@@ -5,10 +5,14 @@
 
 #include "QskStackBox.h"
 #include "QskStackBoxAnimator.h"
+#include "QskPageLoader.h"
 #include "QskEvent.h"
 #include "QskQuick.h"
 
 #include <QPointer>
+#include <QHash>
+
+#include <algorithm>
 
 class QskStackBox::PrivateData
 {
@@ -18,6 +22,16 @@ class QskStackBox::PrivateData
 
     int currentIndex = -1;
     Qt::Alignment defaultAlignment = Qt::AlignLeft | Qt::AlignVCenter;
+
+    // on demand pages
+    QHash< const QQuickItem*, quint64 > pageUsage;
+    quint64 usageCount = 0;
+
+    qint64 pageMemoryBudget = 0;
+    int pageCacheLimit = -1;
+
+    bool preloadingNeighbours = false;
+    bool isPageUpdateScheduled = false;
 };
 
 QskStackBox::QskStackBox( QQuickItem* parent )
@@ -30,6 +44,15 @@ QskStackBox::QskStackBox( bool autoAddChildren, QQuickItem* parent )
     , m_data( new PrivateData() )
 {
     setAutoAddChildren( autoAddChildren );
+
+    connect( this, &QskStackBox::transientIndexChanged, this,
+        [ this ]( qreal index )
+        {
+            // the transition has reached its end
+            if ( index == m_data->currentIndex )
+                schedulePageUpdate();
+        }
+    );
 }
 
 QskStackBox::~QskStackBox()
@@ -165,6 +188,8 @@ void QskStackBox::setCurrentIndex( int index )
     m_data->currentIndex = index;
     polish();
 
+    schedulePageUpdate();
+
     Q_EMIT currentIndexChanged( m_data->currentIndex );
 }
 
@@ -351,6 +376,177 @@ QRectF QskStackBox::geometryForItemAt( int index ) const
     return QRectF( r.x(), r.y(), 0.0, 0.0 );
 }
 
+void QskStackBox::setPageCacheLimit( int limit )
+{
+    limit = qMax( limit, -1 );
+
+    if ( limit != m_data->pageCacheLimit )
+    {
+        m_data->pageCacheLimit = limit;
+        schedulePageUpdate();
+    }
+}
+
+int QskStackBox::pageCacheLimit() const
+{
+    return m_data->pageCacheLimit;
+}
+
+void QskStackBox::setPageMemoryBudget( qint64 bytes )
+{
+    bytes = qMax( bytes, qint64( 0 ) );
+
+    if ( bytes != m_data->pageMemoryBudget )
+    {
+        m_data->pageMemoryBudget = bytes;
+        schedulePageUpdate();
+    }
+}
+
+qint64 QskStackBox::pageMemoryBudget() const
+{
+    return m_data->pageMemoryBudget;
+}
+
+void QskStackBox::setPreloadingNeighbours( bool on )
+{
+    if ( on != m_data->preloadingNeighbours )
+    {
+        m_data->preloadingNeighbours = on;
+        schedulePageUpdate();
+    }
+}
+
+bool QskStackBox::isPreloadingNeighbours() const
+{
+    return m_data->preloadingNeighbours;
+}
+
+void QskStackBox::schedulePageUpdate()
+{
+    if ( !m_data->isPageUpdateScheduled )
+    {
+        /*
+            Creating pages might be expensive: doing it, when the
+            event queue is processed - not in the middle of
+            an index change or an animation step.
+         */
+        m_data->isPageUpdateScheduled = true;
+        QMetaObject::invokeMethod( this, &QskStackBox::updatePages, Qt::QueuedConnection );
+    }
+}
+
+void QskStackBox::updatePages()
+{
+    m_data->isPageUpdateScheduled = false;
+
+    auto& pageUsage = m_data->pageUsage;
+    const auto& items = m_data->items;
+    const int count = items.count();
+
+    const auto current = currentItem();
+    if ( qobject_cast< const QskPageLoader* >( current ) )
+        pageUsage[ current ] = ++m_data->usageCount;
+
+    const auto animator = m_data->animator.data();
+    if ( animator && animator->isRunning() )
+    {
+        // we will be called again, when the transition is completed
+        return;
+    }
+
+    const auto limit = m_data->pageCacheLimit;
+    const auto budget = m_data->pageMemoryBudget;
+
+    QVector< QskPageLoader* > loaders;
+    loaders.reserve( pageUsage.size() + 2 );
+
+    for ( auto item : items )
+    {
+        auto loader = qobject_cast< QskPageLoader* >( item );
+        if ( loader && loader->isLoaded() )
+            loaders += loader;
+    }
+
+    if ( m_data->preloadingNeighbours && count > 1 && m_data->currentIndex >= 0 )
+    {
+        // wrapping around like QskSwipeView
+        const int indexes[] = { m_data->currentIndex + 1, m_data->currentIndex - 1 + count };
+
+        for ( auto index : indexes )
+        {
+            if ( limit >= 0 && loaders.count() >= limit )
+                break;
+
+            if ( auto loader = qobject_cast< QskPageLoader* >( items[ index % count ] ) )
+            {
+                if ( !loader->isLoaded() )
+                {
+                    /*
+                        Preloaded pages have not been in use: they are not stamped,
+                        so that they are unloaded before any page that has been
+                        shown.
+                     */
+                    loader->load();
+
+                    if ( loader->isLoaded() )
+                        loaders += loader;
+                }
+            }
+        }
+    }
+
+    // forgetting about pages, that have been removed or unloaded
+    for ( auto it = pageUsage.begin(); it != pageUsage.end(); )
+    {
+        // the key might be a dangling pointer
+        const auto isLoaded = std::any_of( loaders.cbegin(), loaders.cend(),
+            [ &it ]( const QskPageLoader* loader ) { return loader == it.key(); } );
+
+        if ( isLoaded )
+            ++it;
+        else
+            it = pageUsage.erase( it );
+    }
+
+    if ( ( limit < 0 || loaders.count() <= limit ) && budget <= 0 )
+        return;
+
+    // least recently used first
+    std::sort( loaders.begin(), loaders.end(),
+        [ &pageUsage ]( const QskPageLoader* loader1, const QskPageLoader* loader2 )
+        { return pageUsage.value( loader1 ) < pageUsage.value( loader2 ); } );
+
+    qint64 cost = 0;
+    if ( budget > 0 )
+    {
+        for ( const auto loader : std::as_const( loaders ) )
+            cost += loader->cost();
+    }
+
+    int loadedCount = loaders.count();
+
+    for ( auto loader : std::as_const( loaders ) )
+    {
+        const bool exceedsLimit = ( limit >= 0 ) && ( loadedCount > limit );
+        const bool exceedsBudget = ( budget > 0 ) && ( cost > budget );
+
+        if ( !( exceedsLimit || exceedsBudget ) )
+            break;
+
+        if ( loader == current )
+            continue;
+
+        if ( budget > 0 )
+            cost -= loader->cost();
+
+        pageUsage.remove( loader );
+
+        loader->unload();
+        loadedCount--;
+    }
+}
+
 void QskStackBox::updateLayout()
 {
     if ( maybeUnresized() )
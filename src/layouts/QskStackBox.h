@@ -60,6 +60,30 @@ class QSK_EXPORT QskStackBox : public QskIndexedLayoutBox
 
     QRectF geometryForItemAt( int index ) const;
 
+    /*
+        Pages, that are inserted as QskPageLoader, are created, when being
+        shown for the first time. The following policies decide when
+        they are unloaded again - least recently shown pages first.
+        The current page and the pages of a running transition are never
+        unloaded.
+     */
+
+    // maximum number of loaded pages, -1: unlimited
+    void setPageCacheLimit( int );
+    int pageCacheLimit() const;
+
+    // maximum cost of the loaded pages in bytes, 0: unlimited
+    void setPageMemoryBudget( qint64 );
+    qint64 pageMemoryBudget() const;
+
+    /*
+        Loading the previous/next page in advance, when being idle and
+        the page cache limit has not been reached. Preloaded pages are
+        unloaded first, as long as they have not been shown.
+     */
+    void setPreloadingNeighbours( bool );
+    bool isPreloadingNeighbours() const;
+
     void dump() const;
 
   Q_SIGNALS:
@@ -89,6 +113,9 @@ class QSK_EXPORT QskStackBox : public QskIndexedLayoutBox
 
     void removeItemInternal( int index, bool unparent );
 
+    void schedulePageUpdate();
+    void updatePages();
+
     class PrivateData;
     std::unique_ptr< PrivateData > m_data;
 };
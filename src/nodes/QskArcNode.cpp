@@ -5,10 +5,11 @@
 
 #include "QskArcNode.h"
 #include "QskArcMetrics.h"
+#include "QskArcRenderer.h"
 #include "QskArcShadowNode.h"
+#include "QskFillNode.h"
 #include "QskMargins.h"
 #include "QskGradient.h"
-#include "QskShapeNode.h"
 #include "QskStrokeNode.h"
 #include "QskSGNode.h"
 #include "QskShadowMetrics.h"
@@ -66,6 +67,33 @@ static inline QRectF qskEffectiveRect(
     return qskValidOrEmptyInnerRect( rect, QskMargins( 0.5 * borderWidth ) );
 }
 
+static void qskUpdateFillNode( QskFillNode* node, const QRectF& rect,
+    const QskArcMetrics& metrics, const QskGradient& fillGradient,
+    qreal devicePixelRatio )
+{
+    /*
+        Gradients following the arc are done by coloring the vertexes,
+        all others by the gradient shaders. In both cases the geometry
+        is a triangle strip, that is calculated without any triangulation.
+     */
+    if ( !fillGradient.isMonochrome()
+        && QskArcRenderer::isGradientSupported( fillGradient ) )
+    {
+        node->setColoring( QskFillNode::Polychrome );
+        QskArcRenderer::renderArc( rect, metrics,
+            fillGradient, *node->geometry(), devicePixelRatio );
+    }
+    else
+    {
+        node->setColoring( rect, qskEffectiveGradient( fillGradient, metrics ) );
+        QskArcRenderer::renderFillGeometry( rect, metrics,
+            *node->geometry(), devicePixelRatio );
+    }
+
+    node->markDirty( QSGNode::DirtyGeometry );
+    node->geometry()->markVertexDataDirty();
+}
+
 static void qskUpdateChildren( QSGNode* parentNode, quint8 role, QSGNode* node )
 {
     static const QVector< quint8 > roles = { ShadowRole, FillRole, BorderRole };
@@ -82,6 +110,16 @@ QskArcNode::~QskArcNode()
 {
 }
 
+void QskArcNode::setDevicePixelRatio( qreal ratio )
+{
+    m_devicePixelRatio = ratio;
+}
+
+qreal QskArcNode::devicePixelRatio() const
+{
+    return m_devicePixelRatio;
+}
+
 void QskArcNode::setArcData( const QRectF& rect,
     const QskArcMetrics& arcMetrics, const QskGradient& fillGradient )
 {
@@ -99,12 +137,11 @@ void QskArcNode::setArcData( const QRectF& rect, const QskArcMetrics& arcMetrics
     const QColor& shadowColor, const QskShadowMetrics& shadowMetrics )
 {
     const auto metricsArc = qskEffectiveMetrics( arcMetrics, rect );
-    const auto gradient = qskEffectiveGradient( fillGradient, metricsArc );
 
     auto shadowNode = static_cast< QskArcShadowNode* >(
         QskSGNode::findChildNode( this, ShadowRole ) );
 
-    auto fillNode = static_cast< QskShapeNode* >(
+    auto fillNode = static_cast< QskFillNode* >(
         QskSGNode::findChildNode( this, FillRole ) );
 
     auto borderNode = static_cast< QskStrokeNode* >(
@@ -119,12 +156,10 @@ void QskArcNode::setArcData( const QRectF& rect, const QskArcMetrics& arcMetrics
         return;
     }
 
-    const auto isFillNodeVisible = gradient.isVisible() && !metricsArc.isNull();
+    const auto isFillNodeVisible = fillGradient.isVisible() && !metricsArc.isNull();
     const auto isStrokeNodeVisible = borderWidth > 0.0 && borderColor.alpha() > 0;
     const auto isShadowNodeVisible = shadowColor.alpha() > 0.0 && isFillNodeVisible;
 
-    const auto path = metricsArc.painterPath( arcRect );
-
     if ( isShadowNodeVisible )
     {
         if ( shadowNode == nullptr )
@@ -157,11 +192,12 @@ void QskArcNode::setArcData( const QRectF& rect, const QskArcMetrics& arcMetrics
     {
         if ( fillNode == nullptr )
         {
-            fillNode = new QskShapeNode;
+            fillNode = new QskFillNode;
             QskSGNode::setNodeRole( fillNode, FillRole );
         }
 
-        fillNode->updateNode( path, QTransform(), arcRect, gradient );
+        qskUpdateFillNode( fillNode, arcRect, metricsArc,
+            fillGradient, m_devicePixelRatio );
     }
     else
     {
@@ -180,7 +216,7 @@ void QskArcNode::setArcData( const QRectF& rect, const QskArcMetrics& arcMetrics
         QPen pen( borderColor, borderWidth );
         pen.setCapStyle( Qt::FlatCap );
 
-        borderNode->updateNode( path, QTransform(), pen );
+        borderNode->updateNode( metricsArc.painterPath( arcRect ), QTransform(), pen );
     }
     else
     {
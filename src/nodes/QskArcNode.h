@@ -13,9 +13,9 @@ class QskGradient;
 class QskShadowMetrics;
 
 /*
-    For the moment a QPainterPath/QskShapeNode.
-    But we can do better by creatig vertex lists manually
-    like what is done by the box renderer. TODO ...
+    The filling is a triangle strip calculated by QskArcRenderer, while
+    the border is still a stroked QPainterPath. Deriving from QskShapeNode
+    is for compatibility reasons only.
  */
 class QSK_EXPORT QskArcNode : public QskShapeNode
 {
@@ -23,6 +23,10 @@ class QSK_EXPORT QskArcNode : public QskShapeNode
     QskArcNode();
     ~QskArcNode() override;
 
+    // the device pixel ratio of the window, used for the tessellation
+    void setDevicePixelRatio( qreal );
+    qreal devicePixelRatio() const;
+
     void setArcData( const QRectF&, const QskArcMetrics&, const QskGradient& );
 
     void setArcData( const QRectF&, const QskArcMetrics&,
@@ -31,6 +35,9 @@ class QSK_EXPORT QskArcNode : public QskShapeNode
     void setArcData( const QRectF&, const QskArcMetrics&,
         qreal borderWidth, const QColor& borderColor, const QskGradient&,
         const QColor& shadowColor, const QskShadowMetrics&);
+
+  private:
+    qreal m_devicePixelRatio = 1.0;
 };
 
 #endif
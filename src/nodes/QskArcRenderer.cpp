@@ -0,0 +1,208 @@
+/******************************************************************************
+ * QSkinny - Copyright (C) The authors
+ *           SPDX-License-Identifier: BSD-3-Clause
+ *****************************************************************************/
+
+#include "QskArcRenderer.h"
+#include "QskArcMetrics.h"
+#include "QskGradient.h"
+#include "QskVertex.h"
+
+#include <qrect.h>
+#include <qsggeometry.h>
+#include <qvarlengtharray.h>
+
+static inline int qskSegmentCount(
+    qreal radius, qreal spanAngle, qreal devicePixelRatio )
+{
+    /*
+        The maximum distance between a chord and its arc is
+        r * ( 1 - cos( step / 2 ) ). Limiting it to a quarter of a device
+        pixel gives us smooth arcs without wasting vertexes for small ones.
+     */
+    const qreal tolerance = 0.25 / qMax( devicePixelRatio, 1.0 );
+
+    qreal step = M_PI_2;
+    if ( radius > tolerance )
+        step = qMin( step, 2.0 * std::acos( 1.0 - tolerance / radius ) );
+
+    const auto span = qAbs( qDegreesToRadians( spanAngle ) );
+    const auto count = static_cast< int >( std::ceil( span / step ) );
+
+    return qBound( 1, count, 1000 );
+}
+
+namespace
+{
+    class ArcGeometry
+    {
+      public:
+        ArcGeometry( const QRectF& rect,
+                const QskArcMetrics& metrics, qreal devicePixelRatio )
+            : m_cx( rect.center().x() )
+            , m_cy( rect.center().y() )
+            , m_rx( 0.5 * rect.width() )
+            , m_ry( 0.5 * rect.height() )
+            , m_start( qDegreesToRadians( metrics.startAngle() ) )
+            , m_span( qDegreesToRadians( metrics.spanAngle() ) )
+        {
+            // see QskArcMetrics::painterPath
+
+            const auto sz = qMin( rect.width(), rect.height() );
+            const auto t = metrics.thickness();
+
+            if ( sz > 0.0 && t > 0.0 && !qFuzzyIsNull( metrics.spanAngle() ) )
+            {
+                m_innerRx = m_rx - t * rect.width() / sz;
+                m_innerRy = m_ry - t * rect.height() / sz;
+
+                if ( m_innerRx <= 0.0 || m_innerRy <= 0.0 )
+                {
+                    // a pie
+                    m_innerRx = m_innerRy = 0.0;
+                }
+
+                m_segmentCount = qskSegmentCount(
+                    qMax( m_rx, m_ry ), metrics.spanAngle(), devicePixelRatio );
+            }
+        }
+
+        inline bool isNull() const
+        {
+            return m_segmentCount <= 0;
+        }
+
+        inline int segmentCount() const
+        {
+            return m_segmentCount;
+        }
+
+        // pos: [0.0, 1.0] from the beginning to the end of the arc
+        template< class Line >
+        inline void setLine( qreal pos, Line* line, QskVertex::Color color ) const
+        {
+            const auto angle = m_start + pos * m_span;
+
+            const auto cos = std::cos( angle );
+            const auto sin = std::sin( angle );
+
+            line->setLine( m_cx + m_rx * cos, m_cy - m_ry * sin,
+                m_cx + m_innerRx * cos, m_cy - m_innerRy * sin, color );
+        }
+
+      private:
+        const qreal m_cx, m_cy;
+        const qreal m_rx, m_ry;
+        qreal m_innerRx = 0.0;
+        qreal m_innerRy = 0.0;
+
+        const qreal m_start, m_span;
+
+        int m_segmentCount = 0;
+    };
+
+    class StopPoint
+    {
+      public:
+        qreal pos;
+        QskVertex::Color color;
+    };
+}
+
+void QskArcRenderer::renderFillGeometry( const QRectF& rect,
+    const QskArcMetrics& metrics, QSGGeometry& geometry, qreal devicePixelRatio )
+{
+    const ArcGeometry arc( rect, metrics, devicePixelRatio );
+
+    geometry.setDrawingMode( QSGGeometry::DrawTriangleStrip );
+
+    if ( arc.isNull() )
+    {
+        geometry.allocate( 0 );
+        return;
+    }
+
+    const auto count = arc.segmentCount();
+
+    const auto lines = QskVertex::allocateLines< QskVertex::Line >( geometry, count + 1 );
+    for ( int i = 0; i <= count; i++ )
+        arc.setLine( qreal( i ) / count, lines + i, QskVertex::Color() );
+}
+
+bool QskArcRenderer::isGradientSupported( const QskGradient& gradient )
+{
+    /*
+        For the moment only the gradients, that follow the arc.
+        Linear/Radial/Conic gradients are better done by the
+        shaders of QskGradientMaterial.
+     */
+    return gradient.isVisible() && ( gradient.type() == QskGradient::Stops );
+}
+
+void QskArcRenderer::renderArc( const QRectF& rect, const QskArcMetrics& metrics,
+    const QskGradient& gradient, QSGGeometry& geometry, qreal devicePixelRatio )
+{
+    using namespace QskVertex;
+
+    const ArcGeometry arc( rect, metrics, devicePixelRatio );
+
+    geometry.setDrawingMode( QSGGeometry::DrawTriangleStrip );
+
+    if ( arc.isNull() )
+    {
+        geometry.allocate( 0 );
+        return;
+    }
+
+    const auto& stops = gradient.stops();
+
+    /*
+        Similar to the conic gradient we get from QskArcNode for the shaders:
+        the stops are distributed over the full ellipse beginning at the start
+        angle. For negative spans the arc ends at the beginning of the gradient.
+     */
+    const auto spanRatio = metrics.spanAngle() / 360.0;
+    const auto offset = ( spanRatio >= 0.0 ) ? 0.0 : 1.0;
+
+    QVarLengthArray< StopPoint, 16 > stopPoints;
+
+    if ( spanRatio >= 0.0 )
+    {
+        for ( int i = 0; i < stops.size(); i++ )
+        {
+            const auto pos = stops[i].position() / spanRatio;
+            if ( pos > 0.0 && pos < 1.0 )
+                stopPoints.append( StopPoint { pos, stops[i].rgb() } );
+        }
+    }
+    else
+    {
+        for ( int i = static_cast< int >( stops.size() ) - 1; i >= 0; i-- )
+        {
+            const auto pos = ( stops[i].position() - 1.0 ) / spanRatio;
+            if ( pos > 0.0 && pos < 1.0 )
+                stopPoints.append( StopPoint { pos, stops[i].rgb() } );
+        }
+    }
+
+    const auto count = arc.segmentCount();
+    const auto lineCount = count + 1 + static_cast< int >( stopPoints.size() );
+
+    auto line = allocateLines< ColoredLine >( geometry, lineCount );
+
+    int stopIndex = 0;
+
+    for ( int i = 0; i <= count; i++ )
+    {
+        const auto pos = qreal( i ) / count;
+
+        while ( stopIndex < stopPoints.size() && stopPoints[stopIndex].pos <= pos )
+        {
+            const auto& stopPoint = stopPoints[stopIndex++];
+            arc.setLine( stopPoint.pos, line++, stopPoint.color );
+        }
+
+        const auto color = qskInterpolatedColorAt( stops, offset + pos * spanRatio );
+        arc.setLine( pos, line++, color );
+    }
+}
@@ -0,0 +1,54 @@
+/******************************************************************************
+ * QSkinny - Copyright (C) The authors
+ *           SPDX-License-Identifier: BSD-3-Clause
+ *****************************************************************************/
+
+#ifndef QSK_ARC_RENDERER_H
+#define QSK_ARC_RENDERER_H
+
+#include "QskGlobal.h"
+
+class QskArcMetrics;
+class QskGradient;
+
+class QSGGeometry;
+class QRectF;
+
+namespace QskArcRenderer
+{
+    /*
+        The arc is tessellated into a triangle strip alternating between
+        points of the outer and the inner ellipse ( or the center for pies ).
+        The number of segments depends on the radius, so that the distance
+        between the polygon and the ellipse does not exceed a quarter of a
+        device pixel. The device pixel ratio has to be the one of the window,
+        where the arc is rendered.
+
+        The metrics have to be in absolute coordinates.
+     */
+
+    /*
+        Filling the geometry without any color information:
+            see QSGGeometry::defaultAttributes_Point2D()
+
+        - using shaders setting the color information
+     */
+    QSK_EXPORT void renderFillGeometry( const QRectF&,
+        const QskArcMetrics&, QSGGeometry&, qreal devicePixelRatio = 1.0 );
+
+    /*
+        Filling the geometry with color information:
+            see QSGGeometry::defaultAttributes_ColoredPoint2D()
+
+        The stops of the gradient are distributed along the arc like
+        in a conic gradient, that starts at the beginning of the arc and
+        goes around the full ellipse. Additional vertices are inserted
+        at the positions of the stops.
+     */
+    QSK_EXPORT bool isGradientSupported( const QskGradient& );
+
+    QSK_EXPORT void renderArc( const QRectF&, const QskArcMetrics&,
+        const QskGradient&, QSGGeometry&, qreal devicePixelRatio = 1.0 );
+}
+
+#endif
@@ -4,6 +4,7 @@
  *****************************************************************************/
 
 #include "QskBasicLinesNode.h"
+#include "QskStippleMetrics.h"
 
 #include <qsgmaterial.h>
 #include <qsggeometry.h>
@@ -28,6 +29,20 @@ static inline QVector2D qskOrigin(
     );
 }
 
+static const QSGGeometry::AttributeSet& qskStippledAttributes()
+{
+    static const QSGGeometry::Attribute attributes[] =
+    {
+        QSGGeometry::Attribute::create( 0, 2, QSGGeometry::FloatType, true ),
+        QSGGeometry::Attribute::create( 1, 1, QSGGeometry::FloatType )
+    };
+
+    static const QSGGeometry::AttributeSet attributeSet =
+        { 2, sizeof( QskBasicLinesNode::StippledPoint2D ), attributes };
+
+    return attributeSet;
+}
+
 #if QT_VERSION < QT_VERSION_CHECK( 6, 0, 0 )
     #include <QSGMaterialRhiShader>
     using RhiShader = QSGMaterialRhiShader;
@@ -37,10 +52,34 @@ static inline QVector2D qskOrigin(
 
 namespace
 {
+    class Dashes
+    {
+      public:
+        bool operator==( const Dashes& other ) const noexcept
+        {
+            return ( offset == other.offset ) && ( period == other.period )
+                && ( ends[0] == other.ends[0] ) && ( ends[1] == other.ends[1] );
+        }
+
+        inline bool operator!=( const Dashes& other ) const noexcept
+        {
+            return !( *this == other );
+        }
+
+        // offset, period
+        QVector2D range() const { return QVector2D( offset, period ); }
+
+        float offset = 0.0f;
+        float period = 0.0f;
+
+        // the accumulated lengths of the dashes/gaps
+        QVector4D ends[2];
+    };
+
     class Material final : public QSGMaterial
     {
       public:
-        Material();
+        Material( bool stippled );
 
 #if QT_VERSION < QT_VERSION_CHECK( 6, 0, 0 )
         QSGMaterialShader* createShader() const override;
@@ -52,20 +91,32 @@ namespace
 
         int compare( const QSGMaterial* other ) const override;
 
+        const bool m_stippled;
+
         QColor m_color = QColor( 255, 255, 255 );
         Qt::Orientations m_pixelAlignment;
+
+        Dashes m_dashes;
     };
 
     class ShaderRhi final : public RhiShader
     {
       public:
 
-        ShaderRhi()
+        ShaderRhi( bool stippled )
         {
             const QString root( ":/qskinny/shaders/" );
 
-            setShaderFileName( VertexStage, root + "crisplines.vert.qsb" );
-            setShaderFileName( FragmentStage, root + "crisplines.frag.qsb" );
+            if ( stippled )
+            {
+                setShaderFileName( VertexStage, root + "dashedlines.vert.qsb" );
+                setShaderFileName( FragmentStage, root + "dashedlines.frag.qsb" );
+            }
+            else
+            {
+                setShaderFileName( VertexStage, root + "crisplines.vert.qsb" );
+                setShaderFileName( FragmentStage, root + "crisplines.frag.qsb" );
+            }
         }
 
         bool updateUniformData( RenderState& state,
@@ -74,7 +125,7 @@ namespace
             auto matOld = static_cast< Material* >( oldMaterial );
             auto matNew = static_cast< Material* >( newMaterial );
 
-            Q_ASSERT( state.uniformData()->size() >= 88 );
+            Q_ASSERT( state.uniformData()->size() >= ( matNew->m_stippled ? 128 : 88 ) );
 
             auto data = state.uniformData()->data();
             bool changed = false;
@@ -112,11 +163,64 @@ namespace
                 changed = true;
             }
 
+            if ( matNew->m_stippled )
+            {
+                if ( ( matOld == nullptr ) || ( matNew->m_dashes != matOld->m_dashes ) )
+                {
+                    const auto& dashes = matNew->m_dashes;
+
+                    const auto range = dashes.range();
+
+                    memcpy( data + 88, &range, 8 );
+                    memcpy( data + 96, dashes.ends, 32 );
+
+                    changed = true;
+                }
+            }
+
             return changed;
         }
     };
 }
 
+static bool qskInitDashes( const QskStippleMetrics& metrics, Dashes& dashes )
+{
+    auto pattern = metrics.pattern();
+
+    /*
+        For odd patterns dashes and gaps swap with each iteration.
+        Doubling the pattern gives us an equivalent even pattern.
+     */
+    if ( pattern.count() % 2 )
+        pattern += pattern;
+
+    if ( pattern.count() > 8 )
+        return false;
+
+    float ends[8];
+
+    float period = 0.0f;
+    for ( int i = 0; i < pattern.count(); i++ )
+    {
+        period += qMax( pattern[i], 0.0 );
+        ends[i] = period;
+    }
+
+    if ( period <= 0.0f )
+        return false;
+
+    // beyond the period: never reached in the shader
+    for ( int i = static_cast< int >( pattern.count() ); i < 8; i++ )
+        ends[i] = period + 1.0f;
+
+    dashes.offset = metrics.offset();
+    dashes.period = period;
+    dashes.ends[0] = QVector4D( ends[0], ends[1], ends[2], ends[3] );
+    dashes.ends[1] = QVector4D( ends[4], ends[5], ends[6], ends[7] );
+
+    return true;
+}
+
 #if QT_VERSION < QT_VERSION_CHECK( 6, 0, 0 )
 
 namespace
@@ -126,21 +230,35 @@ namespace
     class ShaderGL final : public QSGMaterialShader
     {
       public:
-        ShaderGL()
+        ShaderGL( bool stippled )
+            : m_stippled( stippled )
         {
             const QString root( ":/qskinny/shaders/" );
 
-            setShaderSourceFile( QOpenGLShader::Vertex,
-                ":/qskinny/shaders/crisplines.vert" );
+            if ( stippled )
+            {
+                setShaderSourceFile( QOpenGLShader::Vertex,
+                    ":/qskinny/shaders/dashedlines.vert" );
 
-            setShaderSourceFile( QOpenGLShader::Fragment,
-                ":/qt-project.org/scenegraph/shaders/flatcolor.frag" );
+                setShaderSourceFile( QOpenGLShader::Fragment,
+                    ":/qskinny/shaders/dashedlines.frag" );
+            }
+            else
+            {
+                setShaderSourceFile( QOpenGLShader::Vertex,
+                    ":/qskinny/shaders/crisplines.vert" );
+
+                setShaderSourceFile( QOpenGLShader::Fragment,
+                    ":/qt-project.org/scenegraph/shaders/flatcolor.frag" );
+            }
         }
 
         char const* const* attributeNames() const override
         {
             static char const* const names[] = { "in_vertex", nullptr };
-            return names;
+            static char const* const stippledNames[] = { "in_vertex", "in_distance", nullptr };
+
+            return m_stippled ? stippledNames : names;
         }
 
         void initialize() override
@@ -152,6 +270,12 @@ namespace
             m_matrixId = p->uniformLocation( "matrix" );
             m_colorId = p->uniformLocation( "color" );
             m_originId = p->uniformLocation( "origin" );
+
+            if ( m_stippled )
+            {
+                m_dashRangeId = p->uniformLocation( "dashRange" );
+                m_dashesId = p->uniformLocation( "dashes" );
+            }
         }
 
         void updateState( const QSGMaterialShader::RenderState& state,
@@ -179,19 +303,33 @@ namespace
                 const auto origin = qskOrigin(
                     state.viewportRect(), material->m_pixelAlignment );;
                 p->setUniformValue( m_originId, origin );
+
+                if ( m_stippled )
+                {
+                    const auto& dashes = material->m_dashes;
+
+                    p->setUniformValue( m_dashRangeId, dashes.range() );
+                    p->setUniformValueArray( m_dashesId, dashes.ends, 2 );
+                }
             }
         }
 
       private:
+        const bool m_stippled;
+
         int m_matrixId = -1;
         int m_colorId = -1;
         int m_originId = -1;
+
+        int m_dashRangeId = -1;
+        int m_dashesId = -1;
     };
 }
 
 #endif
 
-Material::Material()
+Material::Material( bool stippled )
+    : m_stippled( stippled )
 {
 #if QT_VERSION < QT_VERSION_CHECK( 6, 0, 0 )
     setFlag( QSGMaterial::SupportsRhiShader, true );
@@ -203,16 +341,16 @@ Material::Material()
 QSGMaterialShader* Material::createShader() const
 {
     if ( !( flags() & QSGMaterial::RhiShaderWanted ) )
-        return new ShaderGL();
+        return new ShaderGL( m_stippled );
 
-    return new ShaderRhi();
+    return new ShaderRhi( m_stippled );
 }
 
 #else
 
 QSGMaterialShader* Material::createShader( QSGRendererInterface::RenderMode ) const
 {
-    return new ShaderRhi();
+    return new ShaderRhi( m_stippled );
 }
 
 #endif
@@ -220,7 +358,9 @@ QSGMaterialShader* Material::createShader( QSGRendererInterface::RenderMode ) co
 QSGMaterialType* Material::type() const
 {
     static QSGMaterialType staticType;
-    return &staticType;
+    static QSGMaterialType staticTypeStippled;
+
+    return m_stippled ? &staticTypeStippled : &staticType;
 }
 
 int Material::compare( const QSGMaterial* other ) const
@@ -228,7 +368,8 @@ int Material::compare( const QSGMaterial* other ) const
     auto material = static_cast< const Material* >( other );
 
     if ( ( material->m_color == m_color )
-        && ( material->m_pixelAlignment == m_pixelAlignment ) )
+        && ( material->m_pixelAlignment == m_pixelAlignment )
+        && ( !m_stippled || ( material->m_dashes == m_dashes ) ) )
     {
         return 0;
     }
@@ -241,12 +382,21 @@ class QskBasicLinesNodePrivate final : public QSGGeometryNodePrivate
   public:
     QskBasicLinesNodePrivate()
         : geometry( QSGGeometry::defaultAttributes_Point2D(), 0 )
+        , stippledGeometry( qskStippledAttributes(), 0 )
+        , material( false )
+        , stippledMaterial( true )
     {
         geometry.setDrawingMode( QSGGeometry::DrawLines );
+        stippledGeometry.setDrawingMode( QSGGeometry::DrawLines );
     }
 
     QSGGeometry geometry;
+    QSGGeometry stippledGeometry;
+
     Material material;
+    Material stippledMaterial;
+
+    QskStippleMetrics stippleMetrics;
 };
 
 QskBasicLinesNode::QskBasicLinesNode()
@@ -269,6 +419,8 @@ void QskBasicLinesNode::setPixelAlignment( Qt::Orientations orientations )
     if ( orientations != d->material.m_pixelAlignment )
     {
         d->material.m_pixelAlignment = orientations;
+        d->stippledMaterial.m_pixelAlignment = orientations;
+
         markDirty( QSGNode::DirtyMaterial );
     }
 }
@@ -286,6 +438,8 @@ void QskBasicLinesNode::setColor( const QColor& color )
     if ( c != d->material.m_color )
     {
         d->material.m_color = c;
+        d->stippledMaterial.m_color = c;
+
         markDirty( QSGNode::DirtyMaterial );
     }
 }
@@ -301,7 +455,10 @@ void QskBasicLinesNode::setLineWidth( float lineWidth )
 
     lineWidth = std::max( lineWidth, 0.0f );
     if( lineWidth != d->geometry.lineWidth() )
+    {
         d->geometry.setLineWidth( lineWidth );
+        d->stippledGeometry.setLineWidth( lineWidth );
+    }
 }
 
 float QskBasicLinesNode::lineWidth() const
@@ -309,3 +466,59 @@ float QskBasicLinesNode::lineWidth() const
     return d_func()->geometry.lineWidth();
 }
 
+bool QskBasicLinesNode::isStippleSupported( const QskStippleMetrics& metrics )
+{
+    if ( !metrics.isValid() )
+        return false;
+
+    if ( metrics.isSolid() )
+        return true;
+
+    Dashes dashes;
+    return qskInitDashes( metrics, dashes );
+}
+
+void QskBasicLinesNode::setStippleMetrics( const QskStippleMetrics& metrics )
+{
+    Q_D( QskBasicLinesNode );
+
+    if ( metrics == d->stippleMetrics )
+        return;
+
+    Dashes dashes;
+
+    const bool stippled = metrics.isValid() && !metrics.isSolid()
+        && qskInitDashes( metrics, dashes );
+
+    d->stippleMetrics = stippled ? metrics : QskStippleMetrics();
+
+    if ( stippled )
+    {
+        if ( dashes != d->stippledMaterial.m_dashes )
+        {
+            d->stippledMaterial.m_dashes = dashes;
+            markDirty( QSGNode::DirtyMaterial );
+        }
+    }
+
+    auto geometry = stippled ? &d->stippledGeometry : &d->geometry;
+    if ( geometry != this->geometry() )
+    {
+        // releasing the vertexes of the unused geometry
+        this->geometry()->allocate( 0 );
+
+        setGeometry( geometry );
+        setMaterial( stippled ? &d->stippledMaterial : &d->material );
+    }
+}
+
+QskStippleMetrics QskBasicLinesNode::stippleMetrics() const
+{
+    return d_func()->stippleMetrics;
+}
+
+bool QskBasicLinesNode::isStippled() const
+{
+    Q_D( const QskBasicLinesNode );
+    return geometry() == &d->stippledGeometry;
+}
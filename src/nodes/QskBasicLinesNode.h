@@ -12,18 +12,39 @@
 #include <qnamespace.h>
 
 class QColor;
+class QskStippleMetrics;
 
 class QskBasicLinesNodePrivate;
 
 /*
     A node for stippled or solid lines.
     For the moment limited to horizontal/vertical lines: TODO
+
+    Dashes can be done by the shaders: the geometry then has the distance
+    from the beginning of the line as additional vertex attribute
+    ( see StippledPoint2D ), while pattern and offset are uniforms.
+    So a dashed line needs the same 2 vertexes as a solid one.
  */
 class QSK_EXPORT QskBasicLinesNode : public QSGGeometryNode
 {
     using Inherited = QSGGeometryNode;
 
   public:
+    class StippledPoint2D
+    {
+      public:
+        inline void set( float x, float y, float distance ) noexcept
+        {
+            this->x = x;
+            this->y = y;
+            this->distance = distance;
+        }
+
+        float x;
+        float y;
+        float distance;
+    };
+
     QskBasicLinesNode();
     ~QskBasicLinesNode() override;
 
@@ -36,6 +57,19 @@ class QSK_EXPORT QskBasicLinesNode : public QSGGeometryNode
     void setLineWidth( float );
     float lineWidth() const;
 
+    // patterns with up to 8 dashes/gaps
+    static bool isStippleSupported( const QskStippleMetrics& );
+
+    /*
+        Switching between geometries of StippledPoint2D and
+        QSGGeometry::Point2D: isStippled() is true for
+        non solid metrics only.
+     */
+    void setStippleMetrics( const QskStippleMetrics& );
+    QskStippleMetrics stippleMetrics() const;
+
+    bool isStippled() const;
+
   private:
     Q_DECLARE_PRIVATE( QskBasicLinesNode )
 };
@@ -193,7 +193,7 @@ static inline QskVertex::ColoredLine* qskAddGradientLines(
     const QLineF& l1, const QLineF& l2, const QskGradient& gradient,
     QskVertex::ColoredLine* lines )
 {
-    const auto stops = gradient.stops();
+    const auto& stops = gradient.stops();
 
     if ( stops.first().position() > 0.0 )
         ( lines++ )->setLine( l1, stops.first().rgb() );
@@ -4,58 +4,271 @@
  *****************************************************************************/
 
 #include "QskBoxClipNode.h"
+#include "QskBoxBorderColors.h"
 #include "QskBoxBorderMetrics.h"
+#include "QskBoxMetrics.h"
 #include "QskBoxRenderer.h"
 #include "QskBoxShapeMetrics.h"
 #include "QskFunctions.h"
+#include "QskVertex.h"
 
-static inline QskHashValue qskMetricsHash(
-    const QskBoxShapeMetrics& shape, const QskBoxBorderMetrics& border )
+#include <qsgvertexcolormaterial.h>
+
+#include <cmath>
+
+static inline QskHashValue qskMetricsHash( const QskBoxShapeMetrics& shape,
+    const QskBoxBorderMetrics& border, const QskBoxBorderColors& borderColors )
 {
     QskHashValue hash = 13000;
 
     hash = shape.hash( hash );
-    return border.hash( hash );
+    hash = border.hash( hash );
+    return borderColors.hash( hash );
+}
+
+static inline bool qskIsStencilClippingEnforced()
+{
+    static const bool on = qEnvironmentVariableIntValue( "QSK_STENCIL_CLIPPING" ) > 0;
+    return on;
+}
+
+static inline QColor qskMaskColor( const QskBoxBorderColors& borderColors )
+{
+    // the corners need to look like the border
+
+    if ( !borderColors.isMonochrome() )
+        return QColor();
+
+    const auto rgb = borderColors.left().rgbStart();
+
+    for ( auto edge : { Qt::TopEdge, Qt::RightEdge, Qt::BottomEdge } )
+    {
+        if ( borderColors.gradientAt( edge ).rgbStart() != rgb )
+            return QColor();
+    }
+
+    if ( qAlpha( rgb ) != 255 )
+        return QColor();
+
+    return QColor::fromRgba( rgb );
+}
+
+static inline bool qskIsCornerCovered( const QskBoxMetrics::Corner& c,
+    const QPointF& pos )
+{
+    // is the corner of the inner rectangle inside of the outer shape
+
+    if ( c.radiusX <= 0.0 || c.radiusY <= 0.0 )
+        return true;
+
+    const auto dx = ( pos.x() - c.centerX ) / c.radiusX;
+    const auto dy = ( pos.y() - c.centerY ) / c.radiusY;
+
+    return ( dx * dx + dy * dy ) <= 1.0;
+}
+
+static inline QPointF qskInnerCorner( const QskBoxMetrics::Corner& c, const QRectF& rect )
+{
+    return QPointF( ( c.sx < 0.0 ) ? rect.left() : rect.right(),
+        ( c.sy < 0.0 ) ? rect.top() : rect.bottom() );
+}
+
+static inline QPointF qskInnerNormal(
+    const QskBoxMetrics::Corner& c, qreal cos, qreal sin )
+{
+    // normal of the inner ellipse, pointing towards the corner
+
+    const auto nx = c.sx * cos / c.radiusInnerX;
+    const auto ny = c.sy * sin / c.radiusInnerY;
+
+    const auto length = std::sqrt( nx * nx + ny * ny );
+    if ( length <= 0.0 )
+        return QPointF();
+
+    return QPointF( nx / length, ny / length );
+}
+
+static bool qskRenderMask( const QskBoxMetrics& metrics,
+    const QRectF& clipRect, const QColor& color, QSGGeometry& geometry )
+{
+    /*
+        Triangle fans between the corners of the clip rectangle
+        and the inner sides of the rounded corners. We are only successful,
+        when all of them are covered by the border.
+
+        Along the arcs we add a fringe of one pixel fading out the color,
+        so that the corners of the clipped content are antialiased.
+     */
+
+    int stepCount = 0;
+
+    for ( const auto& c : metrics.corners )
+    {
+        if ( c.radiusInnerX <= 0.0 || c.radiusInnerY <= 0.0 )
+            continue;
+
+        if ( !qskIsCornerCovered( c, qskInnerCorner( c, clipRect ) ) )
+            return false;
+
+        stepCount += c.stepCount;
+    }
+
+    // 1 triangle for the fan + 2 triangles for the fringe
+    geometry.allocate( 9 * stepCount );
+
+    const QskVertex::Color c1( color );
+    const QskVertex::Color c2( 0, 0, 0, 0 );
+
+    const qreal fw = 0.5; // half of the fringe width
+
+    auto p = geometry.vertexDataAsColoredPoint2D();
+
+    for ( const auto& c : metrics.corners )
+    {
+        if ( c.radiusInnerX <= 0.0 || c.radiusInnerY <= 0.0 )
+            continue;
+
+        const auto pos = qskInnerCorner( c, clipRect );
+
+        QskVertex::ArcIterator it( c.stepCount );
+
+        QPointF a1( c.xInner( it.cos() ), c.yInner( it.sin() ) );
+        QPointF n1 = fw * qskInnerNormal( c, it.cos(), it.sin() );
+
+        for ( it.increment(); !it.isDone(); it.increment() )
+        {
+            const QPointF a2( c.xInner( it.cos() ), c.yInner( it.sin() ) );
+            const QPointF n2 = fw * qskInnerNormal( c, it.cos(), it.sin() );
+
+            const auto o1 = a1 + n1;
+            const auto o2 = a2 + n2;
+            const auto i1 = a1 - n1;
+            const auto i2 = a2 - n2;
+
+            p++->set( pos.x(), pos.y(), c1.r, c1.g, c1.b, c1.a );
+            p++->set( o1.x(), o1.y(), c1.r, c1.g, c1.b, c1.a );
+            p++->set( o2.x(), o2.y(), c1.r, c1.g, c1.b, c1.a );
+
+            p++->set( o1.x(), o1.y(), c1.r, c1.g, c1.b, c1.a );
+            p++->set( o2.x(), o2.y(), c1.r, c1.g, c1.b, c1.a );
+            p++->set( i2.x(), i2.y(), c2.r, c2.g, c2.b, c2.a );
+
+            p++->set( o1.x(), o1.y(), c1.r, c1.g, c1.b, c1.a );
+            p++->set( i2.x(), i2.y(), c2.r, c2.g, c2.b, c2.a );
+            p++->set( i1.x(), i1.y(), c2.r, c2.g, c2.b, c2.a );
+
+            a1 = a2;
+            n1 = n2;
+        }
+    }
+
+    return true;
 }
 
 QskBoxClipNode::QskBoxClipNode()
     : m_hash( 0 )
     , m_geometry( QSGGeometry::defaultAttributes_Point2D(), 0 )
+    , m_maskNode( nullptr )
 {
     setGeometry( &m_geometry );
+
+    // keeping the mask on top of the clipped content
+    setFlag( QSGNode::UsePreprocess, true );
 }
 
 QskBoxClipNode::~QskBoxClipNode()
 {
+    if ( m_maskNode )
+    {
+        if ( m_maskNode->parent() )
+            removeChildNode( m_maskNode );
+
+        delete m_maskNode;
+    }
 }
 
 void QskBoxClipNode::setBox( const QRectF& rect,
     const QskBoxShapeMetrics& shape, const QskBoxBorderMetrics& border )
 {
-    const auto hash = qskMetricsHash( shape, border );
+    setBox( rect, shape, border, QskBoxBorderColors() );
+}
+
+void QskBoxClipNode::setBox( const QRectF& rect, const QskBoxShapeMetrics& shape,
+    const QskBoxBorderMetrics& border, const QskBoxBorderColors& borderColors )
+{
+    const auto hash = qskMetricsHash( shape, border, borderColors );
     if ( hash == m_hash && rect == m_rect )
         return;
 
     m_rect = rect;
     m_hash = hash;
 
-    bool isRectangular = false;
+    /*
+        Even in situations, where the clipping is not rectangular, it is
+        useful to know its bounding rectangle
+     */
+    const auto clipRect = qskValidOrEmptyInnerRect( rect, border.widths() );
 
-#if 0
     /*
-        Depending on isRectangular the "renderer can use scissoring instead of stencil,
-        which is significantly faster."
+        The batch renderer ( qsgbatchrenderer.cpp ) is rounding the scissor
+        rectangle to device pixels, so the clip might become up to half
+        a pixel too small/large. As the edges are usually covered by
+        the border this is less of a problem than the costs of stencil
+        clipping - but it can be avoided by QSK_STENCIL_CLIPPING.
+     */
 
-        However the batch renderer ( qsgbatchrenderer.cpp ) is rounding the clip rectangle
-        to integers and the clip might become too small/large.
+    bool isRectangular = false;
+    bool hasMask = false;
 
-        So we always have to use stencil clipping - even if it might have a negative
-        impact on the performance. TODO ...
-     */
+    if ( !qskIsStencilClippingEnforced() )
+    {
+        const QskBoxMetrics metrics( rect, shape, border );
+
+        if ( !metrics.isInsideRounded )
+        {
+            isRectangular = true;
+        }
+        else
+        {
+            const auto color = qskMaskColor( borderColors );
+            if ( color.isValid() )
+            {
+                if ( m_maskNode == nullptr )
+                {
+                    m_maskNode = new QSGGeometryNode();
+                    m_maskNode->setFlag( QSGNode::OwnedByParent, false );
+
+                    auto geometry = new QSGGeometry(
+                        QSGGeometry::defaultAttributes_ColoredPoint2D(), 0 );
+                    geometry->setDrawingMode( QSGGeometry::DrawTriangles );
 
-    if ( shape.isRectangle() )
-        isRectangular = true;
-#endif
+                    m_maskNode->setGeometry( geometry );
+                    m_maskNode->setFlag( QSGNode::OwnsGeometry, true );
+
+                    m_maskNode->setMaterial( new QSGVertexColorMaterial() );
+                    m_maskNode->setFlag( QSGNode::OwnsMaterial, true );
+                }
+
+                auto geometry = m_maskNode->geometry();
+
+                if ( qskRenderMask( metrics, clipRect, color, *geometry ) )
+                {
+                    geometry->markVertexDataDirty();
+                    m_maskNode->markDirty( QSGNode::DirtyGeometry );
+
+                    isRectangular = hasMask = true;
+                }
+            }
+        }
+    }
+
+    if ( m_maskNode && !hasMask )
+    {
+        if ( m_maskNode->parent() )
+            removeChildNode( m_maskNode );
+
+        m_maskNode->geometry()->allocate( 0 );
+    }
 
     if ( isRectangular )
     {
@@ -70,12 +283,32 @@ void QskBoxClipNode::setBox( const QRectF& rect,
         QskBoxRenderer::renderFillGeometry( rect, shape, border, m_geometry );
     }
 
-    /*
-        Even in situations, where the clipping is not rectangular, it is
-        useful to know its bounding rectangle
-     */
-    setClipRect( qskValidOrEmptyInnerRect( rect, border.widths() ) );
+    setClipRect( clipRect );
 
     m_geometry.markVertexDataDirty();
     markDirty( QSGNode::DirtyGeometry );
 }
+
+const QSGGeometry* QskBoxClipNode::maskGeometry() const
+{
+    if ( m_maskNode && m_maskNode->geometry()->vertexCount() > 0 )
+        return m_maskNode->geometry();
+
+    return nullptr;
+}
+
+void QskBoxClipNode::preprocess()
+{
+    /*
+        The clipped content is appended by the skinlets after setBox
+        has been called. So we move the mask to the end, right before
+        rendering.
+     */
+    if ( maskGeometry() && lastChild() != m_maskNode )
+    {
+        if ( m_maskNode->parent() )
+            removeChildNode( m_maskNode );
+
+        appendChildNode( m_maskNode );
+    }
+}
@@ -11,7 +11,24 @@
 
 class QskBoxShapeMetrics;
 class QskBoxBorderMetrics;
+class QskBoxBorderColors;
 
+/*
+    Non rectangular clip nodes force the scene graph renderer into
+    stencil clipping, what is expensive. So QskBoxClipNode clips by a
+    scissor, whenever possible:
+
+    - the inner side of the border is rectangular
+
+    - the inner rectangle is completely covered by the box, and the border
+      is opaque and monochrome. Then the rounded corners of the inner
+      rectangle are masked by painting them in the color of the border on
+      top of the clipped content - with an antialiased edge. This requires, that the border
+      has been painted below the clip node.
+
+    Otherwise stencil clipping is used.
+    Setting the environment variable QSK_STENCIL_CLIPPING disables scissoring.
+ */
 class QSK_EXPORT QskBoxClipNode : public QSGClipNode
 {
   public:
@@ -21,11 +38,23 @@ class QSK_EXPORT QskBoxClipNode : public QSGClipNode
     void setBox( const QRectF&,
         const QskBoxShapeMetrics&, const QskBoxBorderMetrics& );
 
+    void setBox( const QRectF&, const QskBoxShapeMetrics&,
+        const QskBoxBorderMetrics&, const QskBoxBorderColors& );
+
+    /*
+        The colored triangles of the masked corners ( including an
+        antialiasing fringe ). nullptr, when not masking.
+     */
+    const QSGGeometry* maskGeometry() const;
+
+    void preprocess() override;
+
   private:
     QskHashValue m_hash;
     QRectF m_rect;
 
     QSGGeometry m_geometry;
+    QSGGeometryNode* m_maskNode;
 };
 
 #endif
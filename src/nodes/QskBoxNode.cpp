@@ -58,6 +58,16 @@ QskBoxNode::~QskBoxNode()
 {
 }
 
+void QskBoxNode::setGeometryShadow( bool on )
+{
+    m_geometryShadow = on;
+}
+
+bool QskBoxNode::hasGeometryShadow() const
+{
+    return m_geometryShadow;
+}
+
 void QskBoxNode::updateNode( const QRectF& rect,
     const QskBoxShapeMetrics& shape, const QskBoxBorderMetrics& borderMetrics,
     const QskBoxBorderColors& borderColors, const QskGradient& gradient,
@@ -69,8 +79,21 @@ void QskBoxNode::updateNode( const QRectF& rect,
     QskBoxRectangleNode* rectNode = nullptr;
     QskBoxFillNode* fillNode = nullptr;
 
-    if ( !shadowMetrics.isNull()
-        && shadowColor.isValid() && shadowColor.alpha() != 0 )
+    const bool hasShadow = !shadowMetrics.isNull()
+        && shadowColor.isValid() && shadowColor.alpha() != 0;
+
+    const bool isGradientSupported =
+        QskBoxRenderer::isGradientSupported( shape, gradient );
+
+    /*
+        A geometry shadow ends up in the same geometry as border and
+        filling and can be batched with any other box. But its linear
+        falloff is only an approximation of the QskBoxShadowNode.
+     */
+    const bool isGeometryShadow =
+        hasShadow && m_geometryShadow && isGradientSupported;
+
+    if ( hasShadow && !isGeometryShadow )
     {
         shadowNode = qskNode< QskBoxShadowNode >( this, ShadowRole );
         shadowNode->setShadowData( shadowMetrics.shadowRect( rect ),
@@ -83,10 +106,19 @@ void QskBoxNode::updateNode( const QRectF& rect,
         Note, that the border is always done with a QskBoxRectangleNode
      */
 
-    if ( QskBoxRenderer::isGradientSupported( shape, gradient ) )
+    if ( isGradientSupported )
     {
         rectNode = qskNode< QskBoxRectangleNode >( this, BoxRole );
-        rectNode->updateNode( rect, shape, borderMetrics, borderColors, gradient );
+
+        if ( isGeometryShadow )
+        {
+            rectNode->updateNode( rect, shape, borderMetrics, borderColors,
+                gradient, shadowMetrics, shadowColor );
+        }
+        else
+        {
+            rectNode->updateNode( rect, shape, borderMetrics, borderColors, gradient );
+        }
     }
     else
     {
@@ -23,10 +23,21 @@ class QSK_EXPORT QskBoxNode : public QSGNode
     QskBoxNode();
     ~QskBoxNode() override;
 
+    /*
+        Render the shadow into the geometry of the box, when the
+        filling can be done with vertex colors. Disabled by default,
+        as the falloff is linear instead of the smooth one of QskBoxShadowNode.
+     */
+    void setGeometryShadow( bool );
+    bool hasGeometryShadow() const;
+
     void updateNode( const QRectF&,
         const QskBoxShapeMetrics&, const QskBoxBorderMetrics&,
         const QskBoxBorderColors&, const QskGradient&,
         const QskShadowMetrics&, const QColor& shadowColor );
+
+  private:
+    bool m_geometryShadow = false;
 };
 
 #endif
@@ -10,23 +10,37 @@
 #include "QskBoxShapeMetrics.h"
 #include "QskGradient.h"
 #include "QskGradientDirection.h"
+#include "QskShadowMetrics.h"
 #include "QskFillNodePrivate.h"
 
-static inline QskHashValue qskMetricsHash(
-    const QskBoxShapeMetrics& shape, const QskBoxBorderMetrics& borderMetrics )
+static inline QskHashValue qskMetricsHash( const QskBoxShapeMetrics& shape,
+    const QskBoxBorderMetrics& borderMetrics, const QskShadowMetrics& shadowMetrics )
 {
     QskHashValue hash = 13000;
 
     hash = shape.hash( hash );
-    return borderMetrics.hash( hash );
+    hash = borderMetrics.hash( hash );
+    return shadowMetrics.hash( hash );
 }
 
-static inline QskHashValue qskColorsHash(
-    const QskBoxBorderColors& borderColors, const QskGradient& fillGradient )
+static inline QskHashValue qskColorsHash( const QskBoxBorderColors& borderColors,
+    const QskGradient& fillGradient, const QColor& shadowColor )
 {
     QskHashValue hash = 13000;
     hash = borderColors.hash( hash );
-    return fillGradient.hash( hash );
+    hash = fillGradient.hash( hash );
+
+    if ( shadowColor.isValid() )
+        hash = qHash( shadowColor.rgba(), hash );
+
+    return hash;
+}
+
+static inline bool qskHasShadow(
+    const QskShadowMetrics& shadowMetrics, const QColor& shadowColor )
+{
+    return !shadowMetrics.isNull()
+        && shadowColor.isValid() && shadowColor.alpha() != 0;
 }
 
 #if 1
@@ -80,6 +94,15 @@ void QskBoxRectangleNode::updateNode( const QRectF& rect,
 void QskBoxRectangleNode::updateNode( const QRectF& rect,
     const QskBoxShapeMetrics& shape, const QskBoxBorderMetrics& borderMetrics,
     const QskBoxBorderColors& borderColors, const QskGradient& gradient )
+{
+    updateNode( rect, shape, borderMetrics, borderColors,
+        gradient, QskShadowMetrics(), QColor() );
+}
+
+void QskBoxRectangleNode::updateNode( const QRectF& rect,
+    const QskBoxShapeMetrics& shape, const QskBoxBorderMetrics& borderMetrics,
+    const QskBoxBorderColors& borderColors, const QskGradient& gradient,
+    const QskShadowMetrics& shadowMetrics, const QColor& shadowColor )
 {
     Q_D( QskBoxRectangleNode );
 
@@ -89,8 +112,13 @@ void QskBoxRectangleNode::updateNode( const QRectF& rect,
      */
     const auto fillGradient = qskEffectiveGradient( gradient );
 
-    const auto metricsHash = qskMetricsHash( shape, borderMetrics );
-    const auto colorsHash = qskColorsHash( borderColors, fillGradient );
+    const bool hasShadow = qskHasShadow( shadowMetrics, shadowColor );
+
+    const auto metricsHash = qskMetricsHash( shape, borderMetrics,
+        hasShadow ? shadowMetrics : QskShadowMetrics() );
+
+    const auto colorsHash = qskColorsHash( borderColors, fillGradient,
+        hasShadow ? shadowColor : QColor() );
 
     if ( ( metricsHash == d->metricsHash ) &&
         ( colorsHash == d->colorsHash ) && ( rect == d->rect ) )
@@ -124,7 +152,7 @@ void QskBoxRectangleNode::updateNode( const QRectF& rect,
         hasBorder = borderColors.isVisible();
     }
 
-    if ( !hasBorder && !hasFill )
+    if ( !hasBorder && !hasFill && !hasShadow )
     {
         resetGeometry();
         return;
@@ -172,7 +200,7 @@ void QskBoxRectangleNode::updateNode( const QRectF& rect,
         setColoring( coloring );
 
         QskBoxRenderer::renderBox( d->rect, shape, borderMetrics,
-            borderColors, fillGradient, geometry );
+            borderColors, fillGradient, shadowMetrics, shadowColor, geometry );
     }
     else
     {
@@ -13,6 +13,8 @@ class QskBoxShapeMetrics;
 class QskBoxBorderMetrics;
 class QskBoxBorderColors;
 class QskGradient;
+class QskShadowMetrics;
+class QColor;
 
 class QskBoxRectangleNodePrivate;
 
@@ -28,6 +30,12 @@ class QSK_EXPORT QskBoxRectangleNode : public QskFillNode
         const QskBoxShapeMetrics&, const QskBoxBorderMetrics&,
         const QskBoxBorderColors&, const QskGradient& );
 
+    // the shadow is rendered into the same geometry: see QskBoxRenderer
+    void updateNode( const QRectF&,
+        const QskBoxShapeMetrics&, const QskBoxBorderMetrics&,
+        const QskBoxBorderColors&, const QskGradient&,
+        const QskShadowMetrics&, const QColor& shadowColor );
+
     void updateNode( const QRectF& rect, const QskGradient& );
 
     void updateNode( const QRectF& rect,
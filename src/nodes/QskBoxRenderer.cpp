@@ -7,6 +7,7 @@
 #include "QskBoxShapeMetrics.h"
 #include "QskBoxBorderMetrics.h"
 #include "QskBoxBorderColors.h"
+#include "QskShadowMetrics.h"
 #include "QskBoxMetrics.h"
 #include "QskBoxBasicStroker.h"
 #include "QskBoxGradientStroker.h"
@@ -15,6 +16,7 @@
 #include "QskGradientDirection.h"
 #include "QskFunctions.h"
 
+#include <qcolor.h>
 #include <qsggeometry.h>
 
 static inline QskVertex::Line* qskAllocateLines(
@@ -67,6 +69,131 @@ static inline bool qskMaybeSpreading( const QskGradient& gradient )
     return true;
 }
 
+static inline void qskConnectLines( QskVertex::ColoredLine* line )
+{
+    // a degenerated line connecting 2 triangle strips
+    line[0].p1 = line[-1].p2;
+    line[0].p2 = line[+1].p1;
+}
+
+static inline QskVertex::ColoredLine* qskSetShadowLines(
+    const QskBoxBasicStroker& stroker, int fillCount, int borderCount,
+    QskVertex::ColoredLine* lines )
+{
+    auto borderLines = lines + fillCount;
+
+    stroker.setBoxLines( borderCount ? borderLines : nullptr,
+        fillCount ? lines : nullptr );
+
+    for ( int i = 0; i < borderCount; i++ )
+    {
+        // fading out to the outer contour
+        auto& p = borderLines[i].p2;
+        p.r = p.g = p.b = p.a = 0;
+    }
+
+    return lines + fillCount + borderCount;
+}
+
+static void qskRenderBox( const QskBoxMetrics& metrics,
+    const QskBoxBorderColors& borderColors, const QskGradient& gradient,
+    const QskBoxBasicStroker* shadowStroker, QSGGeometry& geometry )
+{
+    geometry.setDrawingMode( QSGGeometry::DrawTriangleStrip );
+
+    int shadowFillCount = 0;
+    int shadowBorderCount = 0;
+
+    if ( shadowStroker )
+    {
+        shadowFillCount = shadowStroker->fillCount();
+        shadowBorderCount = shadowStroker->borderCount();
+    }
+
+    const int shadowCount = shadowFillCount + shadowBorderCount;
+
+    const auto effectiveGradient = qskEffectiveGradient( metrics.innerRect, gradient );
+
+    if ( metrics.innerRect.isEmpty() ||
+        QskBoxRenderer::ColorMap::isGradientSupported( effectiveGradient, metrics.innerRect ) )
+    {
+        /*
+            The gradient can be translated to a QskBoxRenderer::ColorMap and we can do all
+            coloring by adding a color info to points of the contour lines.
+            The orientation of contour lines does not depend on the direction
+            of the gradient vector.
+
+            This allows using simpler and faster algos.
+         */
+
+        const QskBoxBasicStroker stroker( metrics, borderColors, effectiveGradient );
+
+        const int fillCount = stroker.fillCount();
+        const int borderCount = stroker.borderCount();
+        const int extraLine = ( shadowCount && ( fillCount + borderCount ) ) ? 1 : 0;
+
+        auto lines = qskAllocateColoredLines(
+            geometry, shadowCount + extraLine + borderCount + fillCount );
+
+        if ( shadowCount )
+        {
+            lines = qskSetShadowLines( *shadowStroker,
+                shadowFillCount, shadowBorderCount, lines );
+        }
+
+        lines += extraLine;
+
+        auto fillLines = fillCount ? lines : nullptr;
+        auto borderLines = borderCount ? lines + fillCount : nullptr;
+
+        if ( fillLines || borderLines )
+            stroker.setBoxLines( borderLines, fillLines );
+
+        if ( extraLine )
+            qskConnectLines( lines - 1 );
+    }
+    else
+    {
+        /*
+            We need to create gradient and contour lines in the correct order
+            perpendicular to the gradient vector.
+         */
+        const QskBoxBasicStroker borderStroker( metrics, borderColors );
+        QskBoxGradientStroker fillStroker( metrics, effectiveGradient );
+
+        const int fillCount = fillStroker.lineCount();
+        const int borderCount = borderStroker.borderCount();
+        const int extraLine1 = ( shadowCount && ( fillCount + borderCount ) ) ? 1 : 0;
+        const int extraLine2 = ( fillCount && borderCount ) ? 1 : 0;
+
+        auto lines = qskAllocateColoredLines( geometry,
+            shadowCount + extraLine1 + fillCount + borderCount + extraLine2 );
+
+        if ( shadowCount )
+        {
+            lines = qskSetShadowLines( *shadowStroker,
+                shadowFillCount, shadowBorderCount, lines );
+        }
+
+        lines += extraLine1;
+
+        if ( fillCount )
+            fillStroker.setLines( fillCount, lines );
+
+        if ( borderCount )
+            borderStroker.setBorderLines( lines + fillCount + extraLine2 );
+
+        if ( extraLine1 )
+            qskConnectLines( lines - 1 );
+
+        if ( extraLine2 )
+        {
+            // dummy line to connect filling and border
+            qskConnectLines( lines + fillCount );
+        }
+    }
+}
+
 bool QskBoxRenderer::isGradientSupported(
     const QskBoxShapeMetrics&, const QskGradient& gradient )
 {
@@ -153,63 +280,58 @@ void QskBoxRenderer::renderBox( const QRectF& rect,
     const QskBoxBorderColors& borderColors, const QskGradient& gradient,
     QSGGeometry& geometry )
 {
-    geometry.setDrawingMode( QSGGeometry::DrawTriangleStrip );
+    const QskBoxMetrics metrics( rect, shape, border );
+    qskRenderBox( metrics, borderColors, gradient, nullptr, geometry );
+}
 
+void QskBoxRenderer::renderBox( const QRectF& rect,
+    const QskBoxShapeMetrics& shape, const QskBoxBorderMetrics& border,
+    const QskBoxBorderColors& borderColors, const QskGradient& gradient,
+    const QskShadowMetrics& shadowMetrics, const QColor& shadowColor,
+    QSGGeometry& geometry )
+{
     const QskBoxMetrics metrics( rect, shape, border );
-    const auto effectiveGradient = qskEffectiveGradient( metrics.innerRect, gradient );
 
-    if ( metrics.innerRect.isEmpty() ||
-        QskBoxRenderer::ColorMap::isGradientSupported( effectiveGradient, metrics.innerRect ) )
+    if ( shadowMetrics.isNull() || !shadowColor.isValid() || shadowColor.alpha() == 0 )
     {
-        /*
-            The gradient can be translated to a QskBoxRenderer::ColorMap and we can do all
-            coloring by adding a color info to points of the contour lines.
-            The orientation of contour lines does not depend on the direction
-            of the gradient vector.
-
-            This allows using simpler and faster algos.
-         */
+        qskRenderBox( metrics, borderColors, gradient, nullptr, geometry );
+        return;
+    }
 
-        const QskBoxBasicStroker stroker( metrics, borderColors, effectiveGradient );
+    /*
+        QskBoxShadowNode fades out the shadow in a band of the width
+        of the blur radius around the contour of the box, that has been
+        extended by the spread radius. The same band becomes the
+        "border" of the shadow box, with a transparent outer contour.
+     */
 
-        const int fillCount = stroker.fillCount();
-        const int borderCount = stroker.borderCount();
+    const auto sm = shadowMetrics.toAbsolute( rect.size() );
 
-        auto lines = qskAllocateColoredLines( geometry, borderCount + fillCount );
+    const auto blurRadius = qMax( sm.blurRadius(), 0.0 );
+    const auto extent = sm.spreadRadius() + 0.5 * blurRadius;
 
-        auto fillLines = fillCount ? lines : nullptr;
-        auto borderLines = borderCount ? lines + fillCount : nullptr;
+    const auto shadowRect = rect.translated( sm.offset() ).adjusted(
+        -extent, -extent, extent, extent );
 
-        stroker.setBoxLines( borderLines, fillLines );
-    }
-    else
+    auto shadowShape = shape;
+    for ( int i = 0; i < 4; i++ )
     {
-        /*
-            We need to create gradient and contour lines in the correct order
-            perpendicular to the gradient vector.
-         */
-        const QskBoxBasicStroker borderStroker( metrics, borderColors );
-        QskBoxGradientStroker fillStroker( metrics, effectiveGradient );
-
-        const int fillCount = fillStroker.lineCount();
-        const int borderCount = borderStroker.borderCount();
-        const int extraLine = ( fillCount && borderCount ) ? 1 : 0;
-
-        auto lines = qskAllocateColoredLines(
-            geometry, fillCount + borderCount + extraLine );
-
-        if ( fillCount )
-            fillStroker.setLines( fillCount, lines );
-
-        if ( borderCount )
-            borderStroker.setBorderLines( lines + fillCount + extraLine );
+        const auto corner = static_cast< Qt::Corner >( i );
 
-        if ( extraLine )
+        const auto radius = shape.radius( corner );
+        if ( !radius.isEmpty() )
         {
-            // dummy line to connect filling and border
-            const auto l = lines + fillCount;
-            l[0].p1 = l[-1].p2;
-            l[0].p2 = l[+1].p1;
+            shadowShape.setRadius( corner,
+                qMax( radius.width() + extent, 0.0 ),
+                qMax( radius.height() + extent, 0.0 ) );
         }
     }
+
+    const QskBoxMetrics shadowBoxMetrics( shadowRect,
+        shadowShape, QskBoxBorderMetrics( blurRadius ) );
+
+    const QskBoxBasicStroker shadowStroker( shadowBoxMetrics,
+        QskBoxBorderColors( shadowColor ), QskGradient( shadowColor ) );
+
+    qskRenderBox( metrics, borderColors, gradient, &shadowStroker, geometry );
 }
@@ -12,9 +12,11 @@ class QskBoxBorderMetrics;
 class QskBoxBorderColors;
 class QskBoxShapeMetrics;
 class QskGradient;
+class QskShadowMetrics;
 
 class QSGGeometry;
 class QRectF;
+class QColor;
 
 namespace QskBoxRenderer
 {
@@ -47,6 +49,16 @@ namespace QskBoxRenderer
 
     QSK_EXPORT void renderBox( const QRectF&,
         const QskBoxShapeMetrics&, const QskGradient&, QSGGeometry& );
+
+    /*
+        Shadow, border and filling in one geometry. The blur of the shadow
+        is approximated by a ring, where the alpha value of the shadow color
+        decreases linearly from the inner to the outer contour.
+     */
+    QSK_EXPORT void renderBox( const QRectF&,
+        const QskBoxShapeMetrics&, const QskBoxBorderMetrics&,
+        const QskBoxBorderColors&, const QskGradient&,
+        const QskShadowMetrics&, const QColor& shadowColor, QSGGeometry& );
 }
 
 #endif
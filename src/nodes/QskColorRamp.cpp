@@ -11,8 +11,29 @@ QSK_QT_PRIVATE_BEGIN
 #include <private/qsgplaintexture_p.h>
 QSK_QT_PRIVATE_END
 
+#include <qatomic.h>
 #include <qcoreapplication.h>
 
+/*
+    The cache is modified from the scene graph threads, while the
+    statistics are usually requested from the GUI thread. So they
+    are maintained, when inserting/removing textures.
+ */
+static QAtomicInt qskTextureCount;
+static QAtomicInteger< qint64 > qskTextureBytes;
+
+static inline qint64 qskTextureSize( const QSGTexture* texture )
+{
+    const auto size = texture->textureSize();
+    return qint64( size.width() ) * size.height() * 4;
+}
+
+static void qskAddTexture( const QSGTexture* texture, int sign )
+{
+    qskTextureCount.fetchAndAddRelaxed( sign );
+    qskTextureBytes.fetchAndAddRelaxed( sign * qskTextureSize( texture ) );
+}
+
 namespace
 {
     class Texture : public QSGPlainTexture
@@ -69,18 +90,21 @@ namespace
 
     inline size_t qHash( const HashKey& key, size_t seed = 0 )
     {
-        size_t values = seed + key.spreadMode;
-
-        for ( const auto& stop : key.stops )
-            values += stop.rgb();
-
-        return values;
+        // the stops are stored inline: no allocations for the keys
+        return key.stops.hash( seed + key.spreadMode );
     }
 
     class Cache
     {
       public:
-        ~Cache() { qDeleteAll( m_hashTable ); }
+        ~Cache()
+        {
+            for ( auto texture : std::as_const( m_hashTable ) )
+            {
+                qskAddTexture( texture, -1 );
+                delete texture;
+            }
+        }
 
         void cleanupRhi( const QRhi* );
 
@@ -118,6 +142,8 @@ Texture* Cache::texture( const void* rhi,
         texture = new Texture( stops, spreadMode );
         m_hashTable[ key ] = texture;
 
+        qskAddTexture( texture, 1 );
+
         if ( rhi != nullptr )
         {
             auto myrhi = ( QRhi* )rhi;
@@ -139,6 +165,7 @@ void Cache::cleanupRhi( const QRhi* rhi )
     {
         if ( it.key().rhi == rhi )
         {
+            qskAddTexture( it.value(), -1 );
             delete it.value();
             it = m_hashTable.erase( it );
         }
@@ -169,3 +196,13 @@ QSGTexture* QskColorRamp::texture( const void* rhi,
 
     return s_cache->texture( rhi, stops, spreadMode );
 }
+
+int QskColorRamp::textureCount()
+{
+    return qskTextureCount.loadRelaxed();
+}
+
+qint64 QskColorRamp::textureBytes()
+{
+    return qskTextureBytes.loadRelaxed();
+}
@@ -15,6 +15,10 @@ namespace QskColorRamp
 {
     QSGTexture* texture( const void* rhi,
         const QskGradientStops&, QskGradient::SpreadMode );
+
+    // statistics about the cached color tables
+    int textureCount();
+    qint64 textureBytes();
 }
 
 #endif
@@ -6,8 +6,12 @@
 #include "QskGraphicNode.h"
 #include "QskGraphic.h"
 #include "QskColorFilter.h"
+#include "QskGraphicDiskCache.h"
 #include "QskPainterCommand.h"
 
+#include <qimage.h>
+#include <qquickwindow.h>
+
 namespace
 {
     class GraphicData
@@ -73,3 +77,23 @@ QskHashValue QskGraphicNode::hash( const void* nodeData ) const
 
     return graphic.hash( hash );
 }
+
+QImage QskGraphicNode::cachedImage(
+    QQuickWindow* window, const QSize& size, const void* nodeData )
+{
+    const auto graphicData = reinterpret_cast< const GraphicData* >( nodeData );
+    const auto& graphic = graphicData->graphic;
+
+    /*
+        Raster data is not stored in the disk cache and we better
+        keep the hardware accelerated painting for it.
+     */
+    if ( ( graphic.commandTypes() & QskGraphic::RasterData )
+        || !QskGraphicDiskCache::isEnabled() )
+    {
+        return QImage();
+    }
+
+    return QskGraphicDiskCache::image( graphic, graphicData->colorFilter,
+        size, window->effectiveDevicePixelRatio() );
+}
@@ -23,6 +23,9 @@ class QSK_EXPORT QskGraphicNode : public QskPaintedNode
   private:
     virtual void paint( QPainter*, const QSize&, const void* nodeData ) override;
     virtual QskHashValue hash( const void* nodeData ) const override;
+
+    virtual QImage cachedImage( QQuickWindow*,
+        const QSize&, const void* nodeData ) override;
 };
 
 #endif
@@ -0,0 +1,312 @@
+/******************************************************************************
+ * QSkinny - Copyright (C) The authors
+ *           SPDX-License-Identifier: BSD-3-Clause
+ *****************************************************************************/
+
+#include "QskGraphicVectorNode.h"
+#include "QskColorFilter.h"
+#include "QskGradient.h"
+#include "QskGraphic.h"
+#include "QskPainterCommand.h"
+#include "QskShapeNode.h"
+#include "QskStrokeNode.h"
+
+#include <qvarlengtharray.h>
+
+namespace
+{
+    class Primitive
+    {
+      public:
+        const QPainterPath* path;
+        QTransform transform;
+
+        QColor fillColor;
+        QPen pen;
+    };
+
+    using Primitives = QVarLengthArray< Primitive, 16 >;
+}
+
+static inline bool qskIsSolid( const QBrush& brush )
+{
+    return brush.style() == Qt::NoBrush || brush.style() == Qt::SolidPattern;
+}
+
+static inline bool qskIsVisible( const QColor& color )
+{
+    return color.isValid() && color.alpha() > 0;
+}
+
+static inline bool qskIsUniform( const QTransform& transform )
+{
+    // the stroker does not support rotations or non uniform scaling
+
+    if ( transform.type() <= QTransform::TxTranslate )
+        return true;
+
+    return ( transform.type() == QTransform::TxScale )
+        && ( transform.m11() > 0.0 ) && qFuzzyCompare( transform.m11(), transform.m22() );
+}
+
+static bool qskPrimitives( const QskGraphic& graphic,
+    const QskColorFilter& colorFilter, Primitives* primitives )
+{
+    if ( graphic.commandTypes() & QskGraphic::RasterData )
+        return false;
+
+    if ( graphic.testRenderHint( QskGraphic::RenderPensUnscaled ) )
+        return false;
+
+    QPen pen;
+    QBrush brush;
+    QTransform transform;
+    qreal opacity = 1.0;
+
+    for ( const auto& command : graphic.commands() )
+    {
+        switch ( command.type() )
+        {
+            case QskPainterCommand::Path:
+            {
+                const auto fillColor = brush.color();
+
+                const bool hasFill = ( brush.style() == Qt::SolidPattern )
+                    && qskIsVisible( fillColor );
+
+                const bool hasStroke = ( pen.style() != Qt::NoPen )
+                    && qskIsVisible( pen.color() );
+
+                if ( !( hasFill || hasStroke ) )
+                    break;
+
+                if ( hasStroke )
+                {
+                    if ( pen.isCosmetic() || !qskIsSolid( pen.brush() )
+                        || !qskIsUniform( transform ) )
+                    {
+                        return false;
+                    }
+                }
+
+                if ( primitives == nullptr )
+                    break; // checking only
+
+                Primitive primitive { command.path(), transform, QColor(), QPen( Qt::NoPen ) };
+
+                if ( hasFill )
+                {
+                    primitive.fillColor = fillColor;
+                    primitive.fillColor.setAlphaF( fillColor.alphaF() * opacity );
+                }
+
+                if ( hasStroke )
+                {
+                    auto color = pen.color();
+                    color.setAlphaF( color.alphaF() * opacity );
+
+                    primitive.pen = pen;
+                    primitive.pen.setColor( color );
+                }
+
+                *primitives += primitive;
+
+                break;
+            }
+            case QskPainterCommand::State:
+            {
+                const auto data = command.stateData();
+                const auto flags = data->flags;
+
+                if ( flags & QPaintEngine::DirtyPen )
+                    pen = colorFilter.substituted( data->pen );
+
+                if ( flags & QPaintEngine::DirtyBrush )
+                {
+                    brush = colorFilter.substituted( data->brush );
+                    if ( !qskIsSolid( brush ) )
+                        return false;
+                }
+
+                if ( flags & QPaintEngine::DirtyTransform )
+                    transform = data->transform;
+
+                if ( flags & QPaintEngine::DirtyOpacity )
+                    opacity = data->opacity;
+
+                if ( ( flags & QPaintEngine::DirtyClipEnabled ) && data->isClipEnabled )
+                    return false;
+
+                if ( flags & ( QPaintEngine::DirtyClipRegion | QPaintEngine::DirtyClipPath ) )
+                {
+                    if ( data->clipOperation != Qt::NoClip )
+                        return false;
+                }
+
+                if ( flags & QPaintEngine::DirtyCompositionMode )
+                {
+                    if ( data->compositionMode != QPainter::CompositionMode_SourceOver )
+                        return false;
+                }
+
+                break;
+            }
+            default:
+                return false;
+        }
+    }
+
+    return true;
+}
+
+static inline QskHashValue qskHash(
+    const QskGraphic& graphic, const QskColorFilter& colorFilter )
+{
+    // see QskGraphicNode::hash
+
+    QskHashValue hash = 12001;
+
+    const auto& substitutions = colorFilter.substitutions();
+    if ( substitutions.size() > 0 )
+    {
+        hash = qHashBits( substitutions.constData(),
+            substitutions.size() * sizeof( substitutions[ 0 ] ), hash );
+    }
+
+    return graphic.hash( hash );
+}
+
+static void qskUpdateChildNodes( QSGNode* parentNode,
+    const Primitives& primitives, qreal scale )
+{
+    /*
+        The geometry is calculated for the scale factor, so that
+        curves get flattened with an appropriate precision.
+     */
+    QTransform scaling;
+    scaling.scale( scale, scale );
+
+    auto node = parentNode->firstChild();
+
+    for ( const auto& primitive : primitives )
+    {
+        const auto transform = primitive.transform * scaling;
+
+        if ( primitive.fillColor.isValid() )
+        {
+            auto shapeNode = dynamic_cast< QskShapeNode* >( node );
+            if ( shapeNode == nullptr )
+            {
+                shapeNode = new QskShapeNode();
+
+                if ( node )
+                    parentNode->insertChildNodeBefore( shapeNode, node );
+                else
+                    parentNode->appendChildNode( shapeNode );
+            }
+            else
+            {
+                node = node->nextSibling();
+            }
+
+            const auto rect = transform.mapRect( primitive.path->boundingRect() );
+            shapeNode->updateNode( *primitive.path, transform, rect, primitive.fillColor );
+        }
+
+        if ( primitive.pen.style() != Qt::NoPen )
+        {
+            auto strokeNode = dynamic_cast< QskStrokeNode* >( node );
+            if ( strokeNode == nullptr )
+            {
+                strokeNode = new QskStrokeNode();
+
+                if ( node )
+                    parentNode->insertChildNodeBefore( strokeNode, node );
+                else
+                    parentNode->appendChildNode( strokeNode );
+            }
+            else
+            {
+                node = node->nextSibling();
+            }
+
+            strokeNode->updateNode( *primitive.path, transform, primitive.pen );
+        }
+    }
+
+    // removing the nodes, that are not needed anymore
+    while ( node )
+    {
+        auto next = node->nextSibling();
+
+        parentNode->removeChildNode( node );
+        delete node;
+
+        node = next;
+    }
+}
+
+QskGraphicVectorNode::QskGraphicVectorNode()
+{
+}
+
+QskGraphicVectorNode::~QskGraphicVectorNode()
+{
+}
+
+bool QskGraphicVectorNode::isSupported(
+    const QskGraphic& graphic, const QskColorFilter& colorFilter )
+{
+    return qskPrimitives( graphic, colorFilter, nullptr );
+}
+
+bool QskGraphicVectorNode::setGraphic( const QskGraphic& graphic,
+    const QskColorFilter& colorFilter, const QRectF& rect, Qt::Orientations mirrored )
+{
+    const auto hash = qskHash( graphic, colorFilter );
+
+    const QRectF r( 0.0, 0.0, rect.width(), rect.height() );
+    const auto transform = graphic.renderTransform( r );
+
+    const auto scale = qMax( qAbs( transform.m11() ), qAbs( transform.m22() ) );
+    if ( scale <= 0.0 )
+        return false;
+
+    /*
+        As long as the scale factor does not change by more
+        than 1.5 in either direction we keep the geometry and
+        adjust the matrix only.
+     */
+    const auto ratio = ( m_scale > 0.0 ) ? ( scale / m_scale ) : 0.0;
+
+    if ( hash != m_hash || ratio < 1.0 / 1.5 || ratio > 1.5 )
+    {
+        Primitives primitives;
+        if ( !qskPrimitives( graphic, colorFilter, &primitives ) )
+            return false;
+
+        qskUpdateChildNodes( this, primitives, scale );
+
+        m_hash = hash;
+        m_scale = scale;
+    }
+
+    QTransform tr;
+    tr.translate( rect.x(), rect.y() );
+
+    if ( mirrored )
+    {
+        tr.translate( 0.5 * r.width(), 0.5 * r.height() );
+        tr.scale( ( mirrored & Qt::Horizontal ) ? -1.0 : 1.0,
+            ( mirrored & Qt::Vertical ) ? -1.0 : 1.0 );
+        tr.translate( -0.5 * r.width(), -0.5 * r.height() );
+    }
+
+    tr = QTransform::fromScale( 1.0 / m_scale, 1.0 / m_scale ) * transform * tr;
+
+    const QMatrix4x4 matrix( tr );
+    if ( matrix != this->matrix() )
+        setMatrix( matrix );
+
+    return true;
+}
@@ -0,0 +1,43 @@
+/******************************************************************************
+ * QSkinny - Copyright (C) The authors
+ *           SPDX-License-Identifier: BSD-3-Clause
+ *****************************************************************************/
+
+#ifndef QSK_GRAPHIC_VECTOR_NODE_H
+#define QSK_GRAPHIC_VECTOR_NODE_H
+
+#include "QskGlobal.h"
+#include <qsgnode.h>
+
+class QskGraphic;
+class QskColorFilter;
+
+/*
+    QskGraphicVectorNode converts the painter commands of a QskGraphic
+    into triangulated geometry - one QskShapeNode/QskStrokeNode for each
+    filled/stroked path. Resizing the graphic is done by changing the matrix,
+    so that the geometry has to be recalculated for significant scale
+    changes only.
+
+    Only graphics with solid fills and non cosmetic solid pens are supported.
+    For all other graphics - f.e with raster data, gradients or clipping -
+    setGraphic returns false and a QskGraphicNode has to be used instead.
+    isSupported allows to check this in advance, without creating a node.
+ */
+class QSK_EXPORT QskGraphicVectorNode : public QSGTransformNode
+{
+  public:
+    QskGraphicVectorNode();
+    ~QskGraphicVectorNode() override;
+
+    static bool isSupported( const QskGraphic&, const QskColorFilter& );
+
+    bool setGraphic( const QskGraphic&, const QskColorFilter&,
+        const QRectF&, Qt::Orientations mirrored = Qt::Orientations() );
+
+  private:
+    QskHashValue m_hash = 0;
+    qreal m_scale = 0.0;
+};
+
+#endif
@@ -106,6 +106,41 @@ static QSGGeometry::Point2D* qskAddLines( const QTransform& transform,
     return reinterpret_cast< QSGGeometry::Point2D* >( vlines );
 }
 
+static QskBasicLinesNode::StippledPoint2D* qskAddStippledLines(
+    const QTransform& transform, int count, const QLineF* lines,
+    QskBasicLinesNode::StippledPoint2D* points )
+{
+    const bool doTransform = !transform.isIdentity();
+
+    for ( int i = 0; i < count; i++ )
+    {
+        auto p1 = lines[i].p1();
+        auto p2 = lines[i].p2();
+
+        if ( doTransform )
+        {
+            p1 = transform.map( p1 );
+            p2 = transform.map( p2 );
+        }
+
+        // the dashes are calculated by the shader from the distance
+        points++->set( p1.x(), p1.y(), 0.0 );
+        points++->set( p2.x(), p2.y(), QLineF( p1, p2 ).length() );
+    }
+
+    return points;
+}
+
+static inline QskHashValue qskStippleHash(
+    const QskBasicLinesNode* node, const QskStippleMetrics& metrics, QskHashValue seed )
+{
+    /*
+        When the dashes are done by the shader the geometry
+        does not depend on the pattern and the offset.
+     */
+    return node->isStippled() ? qHash( -1, seed ) : metrics.hash( seed );
+}
+
 QskLinesNode::QskLinesNode()
 {
 }
@@ -170,11 +205,13 @@ void QskLinesNode::updateLines( const QColor& color,
         return;
     }
 
+    setStippleMetrics( stippleMetrics );
+
     QskHashValue hash = 9784;
 
-    hash = stippleMetrics.hash( hash );
+    hash = qskStippleHash( this, stippleMetrics, hash );
     hash = qHash( transform, hash );
-    hash = qHashBits( lines, count * sizeof( QLineF ) );
+    hash = qHashBits( lines, count * sizeof( QLineF ), hash );
 
     if ( hash != m_hash )
     {
@@ -201,9 +238,11 @@ void QskLinesNode::updateGrid( const QColor& color,
         return;
     }
 
+    setStippleMetrics( stippleMetrics );
+
     QskHashValue hash = 9784;
 
-    hash = stippleMetrics.hash( hash );
+    hash = qskStippleHash( this, stippleMetrics, hash );
     hash = qHash( transform, hash );
     hash = qHashBits( &rect, sizeof( QRectF ), hash );
     hash = qHash( xValues, hash );
@@ -228,6 +267,19 @@ void QskLinesNode::updateGeometry( const QskStippleMetrics& stippleMetrics,
 {
     auto& geom = *geometry();
 
+    if ( isStippled() )
+    {
+        geom.allocate( 2 * count );
+
+        auto points = static_cast< StippledPoint2D* >( geom.vertexData() );
+        points = qskAddStippledLines( transform, count, lines, points );
+
+        Q_ASSERT( geom.vertexCount() == ( points -
+            static_cast< StippledPoint2D* >( geom.vertexData() ) ) );
+
+        return;
+    }
+
     QSGGeometry::Point2D* points = nullptr;
 
     if ( stippleMetrics.isSolid() )
@@ -282,6 +334,33 @@ void QskLinesNode::updateGeometry(
     const auto x1 = mapX( transform, rect.left() );
     const auto x2 = mapX( transform, rect.right() );
 
+    if ( isStippled() )
+    {
+        geom.allocate( 2 * ( xValues.count() + yValues.count() ) );
+
+        auto points = static_cast< StippledPoint2D* >( geom.vertexData() );
+
+        const auto length1 = qAbs( y2 - y1 );
+        for ( const auto value : xValues )
+        {
+            const auto x = mapX( transform, value );
+
+            points++->set( x, y1, 0.0 );
+            points++->set( x, y2, length1 );
+        }
+
+        const auto length2 = qAbs( x2 - x1 );
+        for ( const auto value : yValues )
+        {
+            const auto y = mapY( transform, value );
+
+            points++->set( x1, y, 0.0 );
+            points++->set( x2, y, length2 );
+        }
+
+        return;
+    }
+
     QSGGeometry::Point2D* points = nullptr;
 
     if ( stippleMetrics.isSolid() )
@@ -415,6 +494,10 @@ void QskLinesNode::updatePolygon( const QColor& color, qreal lineWidth,
         return;
     }
 
+    // the hash of the lines/grid is not valid for the polygon
+    setStippleMetrics( QskStippleMetrics() );
+    m_hash = 0;
+
     if ( true ) // for the moment we always update the geometry. TODO ...
     {
         geometry()->allocate( polygon.count() + 1 );
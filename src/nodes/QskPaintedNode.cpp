@@ -159,7 +159,10 @@ void QskPaintedNode::updateTexture( QQuickWindow* window,
 {
     auto imageNode = findImageNode( this );
 
-    if ( ( m_renderHint == OpenGL ) && QskTextureRenderer::isOpenGLWindow( window ) )
+    auto image = cachedImage( window, size, nodeData );
+
+    if ( image.isNull() && ( m_renderHint == OpenGL )
+        && QskTextureRenderer::isOpenGLWindow( window ) )
     {
         const auto textureId = createTextureGL( window, size, nodeData );
 
@@ -177,7 +180,8 @@ void QskPaintedNode::updateTexture( QQuickWindow* window,
     }
     else
     {
-        const auto image = createImage( window, size, nodeData );
+        if ( image.isNull() )
+            image = createImage( window, size, nodeData );
 
         if ( auto texture = qobject_cast< QSGPlainTexture* >( imageNode->texture() ) )
             texture->setImage( image );
@@ -186,6 +190,11 @@ void QskPaintedNode::updateTexture( QQuickWindow* window,
     }
 }
 
+QImage QskPaintedNode::cachedImage( QQuickWindow*, const QSize&, const void* )
+{
+    return QImage();
+}
+
 QImage QskPaintedNode::createImage( QQuickWindow* window,
     const QSize& size, const void* nodeData )
 {
@@ -53,6 +53,12 @@ class QSK_EXPORT QskPaintedNode : public QSGNode
     // a hash value of '0' always results in repainting
     virtual QskHashValue hash( const void* nodeData ) const = 0;
 
+    /*
+        An image, that is used for the texture instead of painting it.
+        The default implementation returns a null image.
+     */
+    virtual QImage cachedImage( QQuickWindow*, const QSize&, const void* nodeData );
+
   private:
     void updateTexture( QQuickWindow*, const QSize&, const void* nodeData );
 
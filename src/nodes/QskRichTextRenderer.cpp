@@ -7,9 +7,12 @@
 #include "QskTextColors.h"
 #include "QskTextOptions.h"
 
+#include <qcache.h>
+#include <qfont.h>
 #include <qglobalstatic.h>
 #include <qmutex.h>
 #include <qthread.h>
+#include <qvarlengtharray.h>
 
 class QQuickWindow;
 
@@ -56,29 +59,13 @@ namespace
 
         inline void setGeometry( const QRectF& rect )
         {
-            auto d = QQuickTextPrivate::get( this );
-
-#if QT_VERSION >= QT_VERSION_CHECK( 6, 2, 0 )
-            d->heightValidFlag = true;
-            d->widthValidFlag = true;
-#else
-            d->heightValid = true;
-            d->widthValid = true;
-#endif
-
-            if ( ( d->x != rect.x() ) || ( d->y != rect.y() ) )
-            {
-                d->x = rect.x();
-                d->y = rect.y();
-                d->dirty( QQuickItemPrivate::Position );
-            }
-
-            if ( ( d->width != rect.width() ) || ( d->height != rect.height() ) )
-            {
-                d->height = rect.height();
-                d->width = rect.width();
-                d->dirty( QQuickItemPrivate::Size );
-            }
+            /*
+                As the item is reused for the same document we need to
+                go through QQuickText::geometryChange, so that the layout
+                gets updated - but only when being affected by the change.
+             */
+            setPosition( rect.topLeft() );
+            setSize( rect.size() );
         }
 
         inline void setAlignment( Qt::Alignment alignment )
@@ -96,20 +83,56 @@ namespace
             setWrapMode( static_cast< QQuickText::WrapMode >( options.wrapMode() ) );
         }
 
-        inline void begin()
+        void setDocument( const QString& text,
+            const QFont& font, const QskTextOptions& options )
         {
+            /*
+                Parsing the text happens in componentComplete, what is
+                done only once for the lifetime of the item. All other
+                attributes are changed afterwards without having to
+                reparse the document.
+             */
+
             classBegin();
             QQuickTextPrivate::get( this )->updateOnComponentComplete = true;
+
+            setFont( font );
+            setOptions( options );
+            setText( text );
+
+            componentComplete();
         }
 
-        inline void end()
+        inline QSizeF implicitTextSize()
         {
-            componentComplete();
+            if ( !m_implicitSize.isValid() )
+            {
+                setWidth( -1 );
+                m_implicitSize = QSizeF( implicitWidth(), implicitHeight() );
+            }
+
+            return m_implicitSize;
         }
 
-        inline void reset()
+        inline QRectF textRect( const QSizeF& size )
         {
-            setText( QString() );
+            for ( const auto& entry : m_textRects )
+            {
+                if ( entry.first == size )
+                    return entry.second;
+            }
+
+            setAlignment( Qt::Alignment() );
+            setSize( size );
+
+            const auto rect = layedOutTextRect();
+
+            if ( m_textRects.size() == m_textRects.capacity() )
+                m_textRects.remove( 0 );
+
+            m_textRects.append( { size, rect } );
+
+            return rect;
         }
 
         inline QRectF layedOutTextRect() const
@@ -132,12 +155,89 @@ namespace
             QQuickItemPrivate::get( this )->derefWindow();
         }
 
+        inline void resetBaselinePadding()
+        {
+            // undoing the adjustments from updateNode without relayouting
+            auto d = QQuickTextPrivate::get( this );
+            d->extra->topPadding = d->extra->bottomPadding = 0;
+        }
+
       protected:
         QSGNode* updatePaintNode( QSGNode*, UpdatePaintNodeData* ) override
         {
             Q_ASSERT( false );
             return nullptr;
         }
+
+      private:
+        // results of previous layouts, that did not need an alignment
+        QSizeF m_implicitSize;
+        QVarLengthArray< QPair< QSizeF, QRectF >, 4 > m_textRects;
+    };
+
+    class TextKey
+    {
+      public:
+        inline bool operator==( const TextKey& other ) const
+        {
+            return ( text == other.text ) && ( font == other.font )
+                && ( options == other.options );
+        }
+
+        QString text;
+        QFont font;
+        QskTextOptions options;
+    };
+
+    inline QskHashValue qHash( const TextKey& key, QskHashValue seed = 0 )
+    {
+        auto hash = qHash( key.text, seed );
+        hash = qHash( key.font, hash );
+        hash = key.options.hash( hash );
+
+        return hash;
+    }
+
+    /*
+        A bounded LRU cache of items, each of them holding a parsed document
+        with its layout. There is one cache per thread ( see below ):
+
+        - with the basic render loop measuring and creating nodes share
+          the same cache, so that the text is parsed only once, when the
+          size hints of a control are calculated before rendering it.
+
+        - with the threaded render loop the size hints are calculated in
+          the GUI thread and the nodes are created in the scene graph thread.
+          Then each thread parses a text once and reuses its layout
+          for further size requests or node updates.
+     */
+    class TextItemCache final : public QObject
+    {
+      public:
+        TextItemCache()
+        {
+            m_items.setMaxCost( 16 );
+        }
+
+        TextItem* item( const QString& text,
+            const QFont& font, const QskTextOptions& options )
+        {
+            TextKey key { text, font, options };
+
+            auto textItem = m_items.object( key );
+            if ( textItem == nullptr )
+            {
+                textItem = new TextItem();
+                textItem->setDocument( text, font, options );
+
+                m_items.insert( key, textItem );
+            }
+
+            return textItem;
+        }
+
+      private:
+        QCache< TextKey, TextItem > m_items;
     };
 
     class TextItemMap
@@ -148,7 +248,14 @@ namespace
             qDeleteAll( m_hash );
         }
 
-        inline TextItem* item()
+        inline TextItem* item( const QString& text,
+            const QFont& font, const QskTextOptions& options )
+        {
+            return cache()->item( text, font, options );
+        }
+
+      private:
+        TextItemCache* cache()
         {
             const auto thread = QThread::currentThread();
 
@@ -157,27 +264,28 @@ namespace
             auto it = m_hash.constFind( thread );
             if ( it == m_hash.constEnd() )
             {
-                auto textItem = new TextItem();
+                auto cache = new TextItemCache();
                 QObject::connect( thread, &QThread::finished,
-                    textItem, [ this, thread ] { removeItem( thread ); } );
+                    cache, [ this, thread ] { removeCache( thread ); } );
 
-                m_hash.insert( thread, textItem );
-                return textItem;
+                m_hash.insert( thread, cache );
+                return cache;
             }
 
             return it.value();
         }
 
-      private:
-        void removeItem( const QThread* thread )
+        void removeCache( const QThread* thread )
         {
-            auto textItem = m_hash.take( thread );
-            if ( textItem )
-                textItem->deleteLater();
+            QMutexLocker locker( &m_mutex );
+
+            auto cache = m_hash.take( thread );
+            if ( cache )
+                cache->deleteLater();
         }
 
         QMutex m_mutex;
-        QHash< const QThread*, TextItem* > m_hash;
+        QHash< const QThread*, TextItemCache* > m_hash;
     };
 }
 
@@ -191,49 +299,16 @@ Q_GLOBAL_STATIC( TextItemMap, qskTextItemMap )
 QSizeF QskRichTextRenderer::textSize(
     const QString& text, const QFont& font, const QskTextOptions& options )
 {
-    auto& textItem = *qskTextItemMap->item();
-
-    textItem.begin();
-
-    textItem.setFont( font );
-    textItem.setOptions( options );
-
-    textItem.setWidth( -1 );
-    textItem.setText( text );
-
-    textItem.end();
-
-    const QSizeF sz( textItem.implicitWidth(), textItem.implicitHeight() );
-
-    textItem.reset();
-
-    return sz;
+    auto textItem = qskTextItemMap->item( text, font, options );
+    return textItem->implicitTextSize();
 }
 
 QRectF QskRichTextRenderer::textRect(
     const QString& text, const QFont& font,
     const QskTextOptions& options, const QSizeF& size )
 {
-    auto& textItem = *qskTextItemMap->item();
-
-    textItem.begin();
-
-    textItem.setFont( font );
-    textItem.setOptions( options );
-    textItem.setAlignment( Qt::Alignment() );
-
-    textItem.setWidth( size.width() );
-    textItem.setHeight( size.height() );
-
-    textItem.setText( text );
-
-    textItem.end();
-
-    const auto rect = textItem.layedOutTextRect();
-
-    textItem.reset();
-
-    return rect;
+    auto textItem = qskTextItemMap->item( text, font, options );
+    return textItem->textRect( size );
 }
 
 void QskRichTextRenderer::updateNode(
@@ -242,19 +317,13 @@ void QskRichTextRenderer::updateNode(
     const QskTextColors& colors, Qt::Alignment alignment,
     const QRectF& rect, const QQuickItem* item, QSGTransformNode* node )
 {
-    // are we killing internal caches of QQuickText, when always using
-    // the same item for the creation the text nodes. TODO ...
-
-    auto& textItem = *qskTextItemMap->item();
-
-    textItem.begin();
+    /*
+        When only the colors have changed the document and its layout
+        are taken from the cache and we only have to create the nodes.
+     */
+    auto& textItem = *qskTextItemMap->item( text, font, options );
 
     textItem.setGeometry( rect );
-
-    textItem.setBottomPadding( 0 );
-    textItem.setTopPadding( 0 );
-    textItem.setFont( font );
-    textItem.setOptions( options );
     textItem.setAlignment( alignment );
 
     textItem.setColor( colors.textColor );
@@ -262,10 +331,6 @@ void QskRichTextRenderer::updateNode(
     textItem.setStyleColor( colors.styleColor );
     textItem.setLinkColor( colors.linkColor );
 
-    textItem.setText( text );
-
-    textItem.end();
-
     if ( alignment & Qt::AlignVCenter )
     {
         /*
@@ -289,5 +354,5 @@ void QskRichTextRenderer::updateNode(
     }
 
     textItem.updateTextNode( item->window(), node );
-    textItem.reset();
+    textItem.resetBaselinePadding();
 }
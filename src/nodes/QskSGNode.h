@@ -15,7 +15,8 @@ namespace QskSGNode
     {
         FirstReservedRole = 0xff - 10,
 
-        DebugRole = 0xff - 2,
+        PlaceholderRole = 0xff - 3,
+        DebugRole,
         BackgroundRole,
 
         NoRole
@@ -14,8 +14,8 @@ namespace
     /*
         Thanks to the hooks of the stroker classes we can make use
         of QDashStroker without having to deal with the overhead of
-        QPainterPaths. But it might be worth to check if this could
-        be done in a shader. TODO ...
+        QPainterPaths. QskBasicLinesNode does the dashes in the shader,
+        but only for patterns with up to 8 dashes/gaps.
      */
     class DashStroker : public QDashStroker
     {
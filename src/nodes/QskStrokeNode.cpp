@@ -6,8 +6,11 @@
 #include "QskStrokeNode.h"
 #include "QskVertex.h"
 #include "QskGradient.h"
+#include "QskFillNodePrivate.h"
 
 #include <qpainterpath.h>
+#include <qhash.h>
+#include <qvector.h>
 
 QSK_QT_PRIVATE_BEGIN
 #include <private/qtriangulatingstroker_p.h>
@@ -31,7 +34,99 @@ static inline bool qskIsPenVisible( const QPen& pen )
     return true;
 }
 
+static inline QskHashValue qskPathHash( const QPainterPath& path, QskHashValue seed )
+{
+    auto hash = qHash( path.elementCount(), seed );
+
+    for ( int i = 0; i < path.elementCount(); i++ )
+    {
+        const auto element = path.elementAt( i );
+
+        hash = qHash( element.x, hash );
+        hash = qHash( element.y, hash );
+        hash = qHash( int( element.type ), hash );
+    }
+
+    return hash;
+}
+
+static inline QskHashValue qskPenHash( const QPen& pen, QskHashValue seed )
+{
+    auto hash = qHash( pen.widthF(), seed );
+
+    hash = qHash( int( pen.style() ), hash );
+    hash = qHash( int( pen.capStyle() ), hash );
+    hash = qHash( int( pen.joinStyle() ), hash );
+    hash = qHash( pen.miterLimit(), hash );
+    hash = qHash( pen.isCosmetic(), hash );
+
+    if ( pen.style() != Qt::SolidLine )
+    {
+        hash = qHash( pen.dashOffset(), hash );
+        hash = qHash( pen.dashPattern(), hash );
+    }
+
+    return hash;
+}
+
+static inline bool qskIsMappable( const QTransform& transform, const QPen& pen )
+{
+    if ( transform.type() <= QTransform::TxTranslate )
+        return true;
+
+    /*
+        The stroke of a uniformly scaled path is the scaled stroke.
+        For cosmetic pens the width does not scale.
+     */
+    if ( transform.type() == QTransform::TxScale && !pen.isCosmetic() )
+    {
+        return ( transform.m11() > 0.0 )
+            && qFuzzyCompare( transform.m11(), transform.m22() );
+    }
+
+    return false;
+}
+
+static void qskMapVertices( const QTransform& transform,
+    const QVector< float >& vertices, QSGGeometry& geometry )
+{
+    const auto dx = float( transform.dx() );
+    const auto dy = float( transform.dy() );
+
+    const auto sx = float( transform.m11() );
+    const auto sy = float( transform.m22() );
+
+    const auto from = vertices.constData();
+
+    const int stride = geometry.sizeOfVertex() / sizeof( float );
+    auto v = static_cast< float* >( geometry.vertexData() );
+
+    for ( int i = 0; i < geometry.vertexCount(); i++ )
+    {
+        v[0] = from[2 * i] * sx + dx;
+        v[1] = from[2 * i + 1] * sy + dy;
+
+        v += stride;
+    }
+}
+
+class QskStrokeNodePrivate final : public QskFillNodePrivate
+{
+  public:
+    // path, pen and the colors of the vertices
+    QskHashValue hash = 0;
+
+    // the transformation, that has been used for stroking
+    QTransform strokeTransform;
+
+    // the vertices of the stroker, always mapped from
+    QVector< float > vertices;
+
+    QTransform transform;
+};
+
 QskStrokeNode::QskStrokeNode()
+    : QskFillNode( *new QskStrokeNodePrivate )
 {
 }
 
@@ -45,8 +140,14 @@ void QskStrokeNode::updateNode( const QPainterPath& path, const QPen& pen )
 void QskStrokeNode::updateNode(
     const QPainterPath& path, const QTransform& transform, const QPen& pen )
 {
+    Q_D( QskStrokeNode );
+
     if ( path.isEmpty() || !qskIsPenVisible( pen ) )
     {
+        d->hash = 0;
+        d->transform = d->strokeTransform = QTransform();
+        d->vertices.clear();
+
         resetGeometry();
         return;
     }
@@ -63,73 +164,119 @@ void QskStrokeNode::updateNode(
     else
         setColoring( pen.color() );
 
-    if ( true ) // For the moment we always update the geometry. TODO ...
+    /*
+        Changing the coloring might have resetted the geometry,
+        so the coloring has to be part of the hash.
+     */
+    auto hash = qskPathHash( path, 0 );
+    hash = qskPenHash( pen, hash );
+    hash = qHash( isGeometryColored(), hash );
+
+    if ( isGeometryColored() )
+        hash = qHash( pen.color().rgba(), hash );
+
+    if ( hash == d->hash && geometry()->vertexCount() > 0 )
     {
+        if ( transform == d->transform )
+            return;
+
         /*
-            Unfortunately QTriangulatingStroker does not offer on the fly
-            transformations - like with qTriangulate. TODO ...
+            Mapping the vertices instead of running the stroker again.
+            We always map from the vertices of the stroker to avoid
+            accumulating rounding errors. When scaling up too much the
+            flattening of the curves becomes visible and we better
+            stroke again.
          */
-        const auto scaledPath = transform.map( path );
-
-        auto effectivePen = pen;
-
-        if ( !effectivePen.isCosmetic() )
+        if ( d->strokeTransform.isInvertible()
+            && d->vertices.count() == 2 * geometry()->vertexCount() )
         {
-            const auto scaleFactor = qMin( transform.m11(), transform.m22() );
-            if ( scaleFactor != 1.0 )
+            const auto delta = d->strokeTransform.inverted() * transform;
+
+            if ( qskIsMappable( delta, pen ) && delta.m11() <= 1.5 )
             {
-                effectivePen.setWidth( effectivePen.widthF() * scaleFactor );
-                effectivePen.setCosmetic( false );
+                d->transform = transform;
+
+                qskMapVertices( delta, d->vertices, *geometry() );
+
+                geometry()->markVertexDataDirty();
+                markDirty( QSGNode::DirtyGeometry );
+
+                return;
             }
         }
+    }
+
+    d->hash = hash;
+    d->transform = d->strokeTransform = transform;
+
+    /*
+        Unfortunately QTriangulatingStroker does not offer on the fly
+        transformations - like with qTriangulate. TODO ...
+     */
+    const auto scaledPath = transform.map( path );
 
-        QTriangulatingStroker stroker;
+    auto effectivePen = pen;
 
-        if ( pen.style() == Qt::SolidLine )
+    if ( !effectivePen.isCosmetic() )
+    {
+        const auto scaleFactor = qMin( transform.m11(), transform.m22() );
+        if ( scaleFactor != 1.0 )
         {
-            // clipRect, renderHint are ignored in QTriangulatingStroker::process
-            stroker.process( qtVectorPathForPath( scaledPath ), effectivePen, {}, {} );
+            effectivePen.setWidthF( effectivePen.widthF() * scaleFactor );
+            effectivePen.setCosmetic( false );
         }
-        else
-        {
-            constexpr QRectF clipRect; // empty rect: no clipping
+    }
 
-            QDashedStrokeProcessor dashStroker;
-            dashStroker.process( qtVectorPathForPath( scaledPath ),
-                effectivePen, clipRect, {} );
+    QTriangulatingStroker stroker;
 
-            const QVectorPath dashedVectorPath( dashStroker.points(),
-                dashStroker.elementCount(), dashStroker.elementTypes(), 0 );
+    if ( pen.style() == Qt::SolidLine )
+    {
+        // clipRect, renderHint are ignored in QTriangulatingStroker::process
+        stroker.process( qtVectorPathForPath( scaledPath ), effectivePen, {}, {} );
+    }
+    else
+    {
+        constexpr QRectF clipRect; // empty rect: no clipping
 
-            stroker.process( dashedVectorPath, effectivePen, {}, {} );
-        }
+        QDashedStrokeProcessor dashStroker;
+        dashStroker.process( qtVectorPathForPath( scaledPath ),
+            effectivePen, clipRect, {} );
 
-        auto& geometry = *this->geometry();
+        const QVectorPath dashedVectorPath( dashStroker.points(),
+            dashStroker.elementCount(), dashStroker.elementTypes(), 0 );
 
-        // 2 vertices for each point
-        geometry.setDrawingMode( QSGGeometry::DrawTriangleStrip );
-        geometry.allocate( stroker.vertexCount() / 2 );
+        stroker.process( dashedVectorPath, effectivePen, {}, {} );
+    }
 
-        if ( isGeometryColored() )
-        {
-            const QskVertex::Color c( pen.color() );
+    auto& geometry = *this->geometry();
 
-            const auto v = stroker.vertices();
-            auto points = geometry.vertexDataAsColoredPoint2D();
+    // 2 vertices for each point
+    geometry.setDrawingMode( QSGGeometry::DrawTriangleStrip );
+    geometry.allocate( stroker.vertexCount() / 2 );
 
-            for ( int i = 0; i < geometry.vertexCount(); i++ )
-            {
-                const auto j = 2 * i;
-                points[i].set( v[j], v[j + 1], c.r, c.g, c.b, c.a );
-            }
-        }
-        else
+    if ( isGeometryColored() )
+    {
+        const QskVertex::Color c( pen.color() );
+
+        const auto v = stroker.vertices();
+        auto points = geometry.vertexDataAsColoredPoint2D();
+
+        for ( int i = 0; i < geometry.vertexCount(); i++ )
         {
-            memcpy( geometry.vertexData(), stroker.vertices(),
-                stroker.vertexCount() * sizeof( float ) );
+            const auto j = 2 * i;
+            points[i].set( v[j], v[j + 1], c.r, c.g, c.b, c.a );
         }
-
-        geometry.markVertexDataDirty();
-        markDirty( QSGNode::DirtyGeometry );
     }
+    else
+    {
+        memcpy( geometry.vertexData(), stroker.vertices(),
+            stroker.vertexCount() * sizeof( float ) );
+    }
+
+    d->vertices.resize( 2 * geometry.vertexCount() );
+    memcpy( d->vertices.data(), stroker.vertices(),
+        d->vertices.count() * sizeof( float ) );
+
+    geometry.markVertexDataDirty();
+    markDirty( QSGNode::DirtyGeometry );
 }
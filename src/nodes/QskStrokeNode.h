@@ -13,6 +13,8 @@ class QPen;
 class QPainterPath;
 class QPolygonF;
 
+class QskStrokeNodePrivate;
+
 class QSK_EXPORT QskStrokeNode : public QskFillNode
 {
     using Inherited = QskFillNode;
@@ -27,6 +29,9 @@ class QSK_EXPORT QskStrokeNode : public QskFillNode
     void updateNode0( const QPolygonF&, qreal lineWidth, const QColor& );
     void updateNode0( const QPolygonF&, const QTransform&,
         qreal lineWidth, const QColor& );
+
+  private:
+    Q_DECLARE_PRIVATE( QskStrokeNode )
 };
 
 #endif
@@ -4,6 +4,7 @@
  *****************************************************************************/
 
 #include "QskTextNode.h"
+#include "QskPlainTextRenderer.h"
 #include "QskTextColors.h"
 #include "QskTextOptions.h"
 #include "QskTextRenderer.h"
@@ -13,8 +14,8 @@
 
 static inline QskHashValue qskHash(
     const QString& text, const QSizeF& size, const QFont& font,
-    const QskTextOptions& options, const QskTextColors& colors,
-    Qt::Alignment alignment, Qsk::TextStyle textStyle )
+    const QskTextOptions& options, Qt::Alignment alignment,
+    Qsk::TextStyle textStyle )
 {
     QskHashValue hash = 11000;
 
@@ -23,7 +24,6 @@ static inline QskHashValue qskHash(
     hash = options.hash( hash );
     hash = qHash( alignment, hash );
     hash = qHash( textStyle, hash );
-    hash = colors.hash( hash );
     hash = qHashBits( &size, sizeof( QSizeF ), hash );
 
     return hash;
@@ -31,6 +31,7 @@ static inline QskHashValue qskHash(
 
 QskTextNode::QskTextNode()
     : m_hash( 0 )
+    , m_layoutHash( 0 )
 {
 }
 
@@ -49,20 +50,34 @@ void QskTextNode::setTextData(
     if ( matrix != this->matrix() ) // avoid setting DirtyMatrix accidently
         setMatrix( matrix );
 
-    const auto hash = qskHash( text, rect.size(), font,
-        options, colors, alignment, textStyle );
+    const auto layoutHash = qskHash( text, rect.size(),
+        font, options, alignment, textStyle );
+
+    const auto hash = colors.hash( layoutHash );
 
     if ( hash != m_hash )
     {
         m_hash = hash;
 
+        if ( ( layoutHash == m_layoutHash )
+            && ( options.format() == QskTextOptions::PlainText ) )
+        {
+            /*
+                Only the colors have changed and we can reuse the glyph nodes.
+                For rich text the colors of the nodes might also come from
+                the document, but QskRichTextRenderer takes the layout from
+                its cache, so that we only have to recreate the nodes.
+             */
+            QskPlainTextRenderer::updateNodeColor( this,
+                colors.textColor, textStyle, colors.styleColor );
+
+            return;
+        }
+
+        m_layoutHash = layoutHash;
+
         const QRectF textRect( 0, 0, rect.width(), rect.height() );
 
-        /*
-            In case of having color changes only we would could
-            go a faster update path: see QskPlainTextRenderer::updateNodeColor.
-            TODO ...
-         */
         QskTextRenderer::updateNode( text, font, options, textStyle,
             colors, alignment, textRect, item, this );
     }
@@ -30,6 +30,7 @@ class QSK_EXPORT QskTextNode : public QSGTransformNode
 
   private:
     QskHashValue m_hash;
+    QskHashValue m_layoutHash;
 };
 
 #endif
@@ -45,6 +45,41 @@ bool QskTreeNode::isSubtreeBlocked() const
     return m_isBlocked;
 }
 
+void QskTreeNode::setNodeHash( quint8 nodeRole, QskHashValue hash )
+{
+    for ( int i = 0; i < m_nodeHashes.size(); i++ )
+    {
+        if ( m_nodeHashes[i].nodeRole == nodeRole )
+        {
+            if ( hash == 0 )
+                m_nodeHashes.remove( i );
+            else
+                m_nodeHashes[i].hash = hash;
+
+            return;
+        }
+    }
+
+    if ( hash != 0 )
+        m_nodeHashes += NodeHash { nodeRole, hash };
+}
+
+QskHashValue QskTreeNode::nodeHash( quint8 nodeRole ) const
+{
+    for ( const auto& nodeHash : m_nodeHashes )
+    {
+        if ( nodeHash.nodeRole == nodeRole )
+            return nodeHash.hash;
+    }
+
+    return 0;
+}
+
+void QskTreeNode::resetNodeHashes()
+{
+    m_nodeHashes.clear();
+}
+
 QskTreeNode* qskTreeNodeCast( QSGNode* node )
 {
     return static_cast< QskTreeNode* >(
@@ -8,6 +8,7 @@
 
 #include "QskGlobal.h"
 #include <qsgnode.h>
+#include <qvector.h>
 
 /*
    Used as paintNode in all QskControls ( see QskControl::updateItemPaintNode )
@@ -21,11 +22,30 @@ class QSK_EXPORT QskTreeNode final : public QSGNode
     void setSubtreeBlocked( bool on, bool notify = true );
     bool isSubtreeBlocked() const override;
 
+    /*
+        Hash values of the inputs of the child nodes, that have been
+        used for the last update ( see QskSkinlet::updateNode ).
+        0 means unknown.
+     */
+    void setNodeHash( quint8 nodeRole, QskHashValue );
+    QskHashValue nodeHash( quint8 nodeRole ) const;
+
+    void resetNodeHashes();
+
   protected:
     QskTreeNode( QSGNodePrivate& );
 
   private:
     bool m_isBlocked = false;;
+
+    struct NodeHash
+    {
+        quint8 nodeRole;
+        QskHashValue hash;
+    };
+
+    // usually only a few entries, no need for a QHash
+    QVector< NodeHash > m_nodeHashes;
 };
 
 QSK_EXPORT QskTreeNode* qskTreeNodeCast( QSGNode* );
@@ -0,0 +1,31 @@
+#version 440
+
+layout( location = 0 ) in float dashDistance;
+layout( location = 0 ) out vec4 fragColor;
+
+layout( std140, binding = 0 ) uniform buf
+{
+    mat4 matrix;
+    vec4 color;
+    vec2 origin;
+    vec2 dashRange; // offset, period
+    vec4 dashes[2];
+} ubuf;
+
+void main()
+{
+    /*
+        dashes: the accumulated lengths of the pattern entries.
+        Counting the entries, that end before the position
+        tells us if we are on a dash or a gap.
+     */
+    float pos = mod( dashDistance + ubuf.dashRange.x, ubuf.dashRange.y );
+
+    float n = dot( step( ubuf.dashes[0], vec4( pos ) ), vec4( 1.0 ) )
+        + dot( step( ubuf.dashes[1], vec4( pos ) ), vec4( 1.0 ) );
+
+    if ( mod( n, 2.0 ) >= 1.0 )
+        discard;
+
+    fragColor = ubuf.color;
+}
@@ -0,0 +1,40 @@
+#version 440
+
+layout( location = 0 ) in vec4 vertexCoord;
+layout( location = 1 ) in float vertexDistance;
+
+layout( location = 0 ) out float dashDistance;
+
+layout( std140, binding = 0 ) uniform buf
+{
+    mat4 matrix;
+    vec4 color;
+    vec2 origin;
+    vec2 dashRange; // offset, period
+    vec4 dashes[2];
+} ubuf;
+
+out gl_PerVertex { vec4 gl_Position; };
+
+void main()
+{
+    dashDistance = vertexDistance;
+
+    vec4 pos = ubuf.matrix * vertexCoord;
+
+    if ( ubuf.origin.x > 0.0 )
+    {
+        pos.x = ( pos.x + 1.0 ) * ubuf.origin.x;
+        pos.x = round( pos.x ) + 0.5;
+        pos.x = pos.x / ubuf.origin.x - 1.0;
+    }
+
+    if ( ubuf.origin.y > 0.0 )
+    {
+        pos.y = ( pos.y + 1.0 ) * ubuf.origin.y;
+        pos.y = round( pos.y ) + 0.5;
+        pos.y = pos.y / ubuf.origin.y - 1.0;
+    }
+
+    gl_Position = pos;
+}
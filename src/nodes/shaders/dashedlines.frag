@@ -0,0 +1,18 @@
+uniform lowp vec4 color;
+uniform highp vec2 dashRange; // offset, period
+uniform highp vec4 dashes[2];
+
+varying highp float dashDistance;
+
+void main()
+{
+    highp float pos = mod( dashDistance + dashRange.x, dashRange.y );
+
+    float n = dot( step( dashes[0], vec4( pos ) ), vec4( 1.0 ) )
+        + dot( step( dashes[1], vec4( pos ) ), vec4( 1.0 ) );
+
+    if ( mod( n, 2.0 ) >= 1.0 )
+        discard;
+
+    gl_FragColor = color;
+}
@@ -23,3 +23,6 @@ qsbcompile gradientlinear-vulkan.frag
 
 qsbcompile crisplines-vulkan.vert
 qsbcompile crisplines-vulkan.frag
+
+qsbcompile dashedlines-vulkan.vert
+qsbcompile dashedlines-vulkan.frag
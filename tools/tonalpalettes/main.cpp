@@ -0,0 +1,149 @@
+/******************************************************************************
+ * QSkinny - Copyright (C) The authors
+ *           SPDX-License-Identifier: BSD-3-Clause
+ *****************************************************************************/
+
+/*
+    Generates the precomputed tables of designsystems/material3/QskMaterial3Palettes.cpp:
+
+        tonalpalettes > designsystems/material3/QskMaterial3Palettes.cpp
+
+    With --check <file> the tables are compared with an existing file instead:
+
+        tonalpalettes --check designsystems/material3/QskMaterial3Palettes.cpp
+
+    The seeds have to match the defaults of QskMaterial3Theme::BaseColors.
+ */
+
+#include <QskHctColor.h>
+#include <QskTonalPalette.h>
+
+#include <QByteArray>
+#include <QFile>
+#include <QString>
+
+#include <cstdio>
+#include <cstring>
+
+namespace
+{
+    struct Seed
+    {
+        const char* name;
+        QRgb rgb;
+    };
+}
+
+static const Seed qskSeeds[] =
+{
+    { "primary", 0xff6750A4 },
+    { "secondary", 0xff625B71 },
+    { "tertiary", 0xff7D5260 },
+    { "error", 0xffB3261E },
+    { "neutral", 0xff605D62 },
+    { "neutralVariant", 0xff605D66 }
+};
+
+static void printTable( QString& out, const Seed& seed )
+{
+    // not using a cached table, even if there is one
+    const QskTonalPalette palette( ( QskHctColor( seed.rgb ) ) );
+
+    out += QStringLiteral( "    {\n" );
+    out += QString::asprintf( "        // %s: 0x%08x\n", seed.name, seed.rgb );
+
+    for ( int i = 0; i < QskTonalPalette::ToneCount; i++ )
+    {
+        if ( i % 6 == 0 )
+            out += QStringLiteral( "        " );
+
+        out += QString::asprintf( "0x%08x,", palette.rgb( i ) );
+
+        const bool isLast = ( i == QskTonalPalette::ToneCount - 1 );
+        out += ( isLast || ( i % 6 == 5 ) ) ? QLatin1Char( '\n' ) : QLatin1Char( ' ' );
+    }
+
+    out += QStringLiteral( "    },\n" );
+}
+
+static QString generatedFile()
+{
+    QString out;
+
+    out += QStringLiteral(
+        "/******************************************************************************\n"
+        " * QSkinny - Copyright (C) The authors\n"
+        " *           SPDX-License-Identifier: BSD-3-Clause\n"
+        " *****************************************************************************/\n"
+        "\n"
+        "#include <QskTonalPalette.h>\n"
+        "\n"
+        "/*\n"
+        "    The tonal palettes of the default QskMaterial3Theme::BaseColors.\n"
+        "    They have been generated by tools/tonalpalettes and need to be\n"
+        "    regenerated, when the seeds or the HCT conversion are changed.\n"
+        " */\n"
+        "static const QRgb qskTables[][ QskTonalPalette::ToneCount ] =\n"
+        "{\n" );
+
+    for ( const auto& seed : qskSeeds )
+        printTable( out, seed );
+
+    out += QStringLiteral(
+        "};\n"
+        "\n"
+        "static void qskRegisterPalettes()\n"
+        "{\n"
+        "    const QRgb seeds[] =\n"
+        "    {\n" );
+
+    const int count = sizeof( qskSeeds ) / sizeof( qskSeeds[0] );
+
+    for ( int i = 0; i < count; i++ )
+    {
+        const auto& seed = qskSeeds[i];
+
+        out += QString::asprintf( "        0xff%06X%s // %s\n", seed.rgb & 0xffffff,
+            ( i < count - 1 ) ? "," : " ", seed.name );
+    }
+
+    out += QStringLiteral(
+        "    };\n"
+        "\n"
+        "    static_assert( sizeof( seeds ) / sizeof( seeds[0] )\n"
+        "        == sizeof( qskTables ) / sizeof( qskTables[0] ), \"Missing palettes\" );\n"
+        "\n"
+        "    for ( size_t i = 0; i < sizeof( seeds ) / sizeof( seeds[0] ); i++ )\n"
+        "        QskTonalPalette::insertTable( seeds[i], qskTables[i] );\n"
+        "}\n"
+        "\n"
+        "Q_CONSTRUCTOR_FUNCTION( qskRegisterPalettes )\n" );
+
+    return out;
+}
+
+int main( int argc, char* argv[] )
+{
+    const auto out = generatedFile().toLatin1();
+
+    if ( argc == 3 && std::strcmp( argv[1], "--check" ) == 0 )
+    {
+        QFile file( QString::fromLocal8Bit( argv[2] ) );
+        if ( !file.open( QIODevice::ReadOnly ) )
+        {
+            std::fprintf( stderr, "Can't read %s\n", argv[2] );
+            return 1;
+        }
+
+        if ( file.readAll() != out )
+        {
+            std::fprintf( stderr, "%s is outdated\n", argv[2] );
+            return 1;
+        }
+
+        return 0;
+    }
+
+    std::fputs( out.constData(), stdout );
+    return 0;
+}